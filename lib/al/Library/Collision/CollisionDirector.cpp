@@ -0,0 +1,15 @@
+#include "Library/Collision/CollisionDirector.h"
+
+#ifdef AL_COLLISION_AABB_TREE
+
+namespace al {
+
+// NON_MATCHING: only built with AL_COLLISION_AABB_TREE, for LiveActorKit to make the AABB tree the
+// active keeper
+void CollisionDirector::setPartsKeeper(ICollisionPartsKeeper* partsKeeper) {
+    mActivePartsKeeper = partsKeeper;
+}
+
+}  // namespace al
+
+#endif
@@ -27,6 +27,8 @@ public:
 
     bool isMoving() const { return mIsMoving; }
 
+    f32 getBoundingSphereRange() const { return mBoundingSphereRange; }
+
     const HitSensor* getConnectedSensor() const { return mConnectedSensor; }
 
 private:
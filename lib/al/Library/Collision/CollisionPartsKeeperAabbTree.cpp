@@ -0,0 +1,516 @@
+#include "Library/Collision/CollisionPartsKeeperAabbTree.h"
+
+#ifdef AL_COLLISION_AABB_TREE
+
+#include <math/seadMathCalcCommon.h>
+
+#include "Library/Collision/CollisionParts.h"
+
+namespace al {
+
+namespace {
+constexpr f32 cBoxMargin = 50.0f;
+constexpr f32 cMovePredictFrames = 4.0f;
+
+void calcPartsSphere(sead::Vector3f* center, f32* radius, const CollisionParts* parts) {
+    parts->getBaseMtx().getTranslation(*center);
+    *radius = parts->getBoundingSphereRange();
+}
+
+f32 calcBoxSurface(const sead::Vector3f& min, const sead::Vector3f& max) {
+    sead::Vector3f size = max - min;
+    return 2.0f * (size.x * size.y + size.y * size.z + size.z * size.x);
+}
+
+void mergeBox(sead::Vector3f* min, sead::Vector3f* max, const sead::Vector3f& minA,
+              const sead::Vector3f& maxA, const sead::Vector3f& minB, const sead::Vector3f& maxB) {
+    min->set(sead::Mathf::min(minA.x, minB.x), sead::Mathf::min(minA.y, minB.y),
+             sead::Mathf::min(minA.z, minB.z));
+    max->set(sead::Mathf::max(maxA.x, maxB.x), sead::Mathf::max(maxA.y, maxB.y),
+             sead::Mathf::max(maxA.z, maxB.z));
+}
+
+f32 calcMergedSurface(const sead::Vector3f& minA, const sead::Vector3f& maxA,
+                      const sead::Vector3f& minB, const sead::Vector3f& maxB) {
+    sead::Vector3f min;
+    sead::Vector3f max;
+    mergeBox(&min, &max, minA, maxA, minB, maxB);
+    return calcBoxSurface(min, max);
+}
+
+bool isInsideBox(const sead::Vector3f& innerMin, const sead::Vector3f& innerMax,
+                 const sead::Vector3f& min, const sead::Vector3f& max) {
+    return min.x <= innerMin.x && min.y <= innerMin.y && min.z <= innerMin.z &&
+           innerMax.x <= max.x && innerMax.y <= max.y && innerMax.z <= max.z;
+}
+
+f32 calcBoxDistanceSquared(const sead::Vector3f& pos, const sead::Vector3f& min,
+                           const sead::Vector3f& max) {
+    sead::Vector3f diff = {pos.x - sead::Mathf::clamp(pos.x, min.x, max.x),
+                           pos.y - sead::Mathf::clamp(pos.y, min.y, max.y),
+                           pos.z - sead::Mathf::clamp(pos.z, min.z, max.z)};
+    return diff.dot(diff);
+}
+
+bool isCrossArrowBox(const sead::Vector3f& pos, const sead::Vector3f& dir,
+                     const sead::Vector3f& min, const sead::Vector3f& max) {
+    const f32 start[3] = {pos.x, pos.y, pos.z};
+    const f32 vec[3] = {dir.x, dir.y, dir.z};
+    const f32 box_min[3] = {min.x, min.y, min.z};
+    const f32 box_max[3] = {max.x, max.y, max.z};
+
+    f32 t_min = 0.0f;
+    f32 t_max = 1.0f;
+    for (s32 axis = 0; axis < 3; axis++) {
+        if (vec[axis] == 0.0f) {
+            if (start[axis] < box_min[axis] || start[axis] > box_max[axis])
+                return false;
+            continue;
+        }
+        f32 t_0 = (box_min[axis] - start[axis]) / vec[axis];
+        f32 t_1 = (box_max[axis] - start[axis]) / vec[axis];
+        t_min = sead::Mathf::max(t_min, sead::Mathf::min(t_0, t_1));
+        t_max = sead::Mathf::min(t_max, sead::Mathf::max(t_0, t_1));
+        if (t_min > t_max)
+            return false;
+    }
+    return true;
+}
+
+bool isCrossArrowSphere(const sead::Vector3f& pos, const sead::Vector3f& dir,
+                        const sead::Vector3f& center, f32 radius) {
+    sead::Vector3f diff = center - pos;
+    f32 length_sq = dir.dot(dir);
+    f32 rate = length_sq > 0.0f ? sead::Mathf::clamp(diff.dot(dir) / length_sq, 0.0f, 1.0f) : 0.0f;
+    sead::Vector3f closest = diff - dir * rate;
+    return closest.dot(closest) <= radius * radius;
+}
+
+struct SphereQuery {
+    bool isCrossBox(const sead::Vector3f& min, const sead::Vector3f& max) const {
+        return calcBoxDistanceSquared(pos, min, max) <= radius * radius;
+    }
+
+    bool isCrossSphere(const sead::Vector3f& center, f32 range) const {
+        sead::Vector3f diff = center - pos;
+        return diff.dot(diff) <= (radius + range) * (radius + range);
+    }
+
+    sead::Vector3f pos;
+    f32 radius;
+};
+
+struct ArrowQuery {
+    bool isCrossBox(const sead::Vector3f& min, const sead::Vector3f& max) const {
+        return isCrossArrowBox(pos, dir, min, max);
+    }
+
+    bool isCrossSphere(const sead::Vector3f& center, f32 range) const {
+        return isCrossArrowSphere(pos, dir, center, range);
+    }
+
+    sead::Vector3f pos;
+    sead::Vector3f dir;
+};
+
+u32 calcPartsHash(const CollisionParts* parts) {
+    return static_cast<u32>(reinterpret_cast<u64>(parts) >> 4) * 0x9e3779b1;
+}
+}  // namespace
+
+CollisionPartsKeeperAabbTree::CollisionPartsKeeperAabbTree(s32 partsNumMax) {
+    mEntryCapacity = partsNumMax > 0 ? partsNumMax : 1;
+    mEntries = new Entry[mEntryCapacity];
+
+    // a tree of n leaves has n - 1 inner nodes
+    mNodeCapacity = mEntryCapacity * 2;
+    mNodes = new Node[mNodeCapacity];
+    for (s32 i = 0; i < mNodeCapacity; i++) {
+        mNodes[i].parent = i + 1 < mNodeCapacity ? i + 1 : -1;
+        mNodes[i].height = -1;
+    }
+
+    mEntryTableSize = 1;
+    while (mEntryTableSize < mEntryCapacity * 2)
+        mEntryTableSize *= 2;
+    mEntryTable = new s32[mEntryTableSize];
+    for (s32 i = 0; i < mEntryTableSize; i++)
+        mEntryTable[i] = -1;
+}
+
+CollisionPartsKeeperAabbTree::~CollisionPartsKeeperAabbTree() {
+    delete[] mNodes;
+    delete[] mEntries;
+    delete[] mEntryTable;
+}
+
+// The tree is built while parts are added, so there is nothing left to do here.
+void CollisionPartsKeeperAabbTree::endInit() {}
+
+void CollisionPartsKeeperAabbTree::addCollisionParts(CollisionParts* parts) {
+    if (findEntry(parts) >= 0)
+        return;
+    if (mEntryNum == mEntryCapacity)
+        grow();
+
+    mEntries[mEntryNum] = {parts, -1};
+    addEntryTable(mEntryNum);
+    connectEntry(mEntryNum);
+    mEntryNum++;
+}
+
+void CollisionPartsKeeperAabbTree::connectToCollisionPartsList(CollisionParts* parts) {
+    s32 index = findEntry(parts);
+    if (index >= 0)
+        connectEntry(index);
+}
+
+void CollisionPartsKeeperAabbTree::disconnectToCollisionPartsList(CollisionParts* parts) {
+    s32 index = findEntry(parts);
+    if (index >= 0)
+        disconnectEntry(index);
+}
+
+// Puts the parts back into the tree at their current place, for parts that were moved without
+// going through movement().
+void CollisionPartsKeeperAabbTree::resetToCollisionPartsList(CollisionParts* parts) {
+    s32 index = findEntry(parts);
+    if (index < 0 || mEntries[index].leafNode < 0)
+        return;
+
+    disconnectEntry(index);
+    connectEntry(index);
+}
+
+// Walks the tree along the parent links, so there is no stack that could run out. Coming down
+// into a node tests its box, coming back up from the first child goes on with the second one.
+template <typename Query>
+void CollisionPartsKeeperAabbTree::searchTree(const Query& query,
+                                              sead::IDelegate1<CollisionParts*>& callback) const {
+    s32 prev = -1;
+    s32 index = mRootNode;
+    while (index >= 0) {
+        const Node& node = mNodes[index];
+        s32 next = node.parent;
+        if (prev == node.parent) {
+            if (!query.isCrossBox(node.min, node.max)) {
+                // leave the subtree
+            } else if (node.isLeaf()) {
+                CollisionParts* parts = mEntries[node.entryIndex].parts;
+                sead::Vector3f center;
+                f32 range;
+                calcPartsSphere(&center, &range, parts);
+                if (query.isCrossSphere(center, range))
+                    callback(parts);
+            } else {
+                next = node.child1;
+            }
+        } else if (prev == node.child1) {
+            next = node.child2;
+        }
+        prev = index;
+        index = next;
+    }
+}
+
+void CollisionPartsKeeperAabbTree::searchWithSphere(const sead::Vector3f& pos, f32 radius,
+                                                    sead::IDelegate1<CollisionParts*>& callback) {
+    searchTree(SphereQuery{pos, radius}, callback);
+}
+
+void CollisionPartsKeeperAabbTree::movement() {
+    for (s32 i = 0; i < mEntryNum; i++)
+        if (mEntries[i].leafNode >= 0 && mEntries[i].parts->isMoving())
+            updateEntry(i);
+}
+
+void CollisionPartsKeeperAabbTree::searchWithArrow(const sead::Vector3f& pos,
+                                                   const sead::Vector3f& dir,
+                                                   sead::IDelegate1<CollisionParts*>& callback) {
+    searchTree(ArrowQuery{pos, dir}, callback);
+}
+
+s32 CollisionPartsKeeperAabbTree::findEntry(const CollisionParts* parts) const {
+    u32 mask = mEntryTableSize - 1;
+    for (u32 i = calcPartsHash(parts) & mask; mEntryTable[i] >= 0; i = (i + 1) & mask)
+        if (mEntries[mEntryTable[i]].parts == parts)
+            return mEntryTable[i];
+    return -1;
+}
+
+// The table is at least twice the size of the entry array, so the probe always finds a free slot.
+void CollisionPartsKeeperAabbTree::addEntryTable(s32 index) {
+    u32 mask = mEntryTableSize - 1;
+    u32 i = calcPartsHash(mEntries[index].parts) & mask;
+    while (mEntryTable[i] >= 0)
+        i = (i + 1) & mask;
+    mEntryTable[i] = index;
+}
+
+// Doubles the entries, the nodes and the entry table. Node indices stay the same, and the new
+// nodes go in front of the free list.
+void CollisionPartsKeeperAabbTree::grow() {
+    s32 entry_capacity = mEntryCapacity * 2;
+    Entry* entries = new Entry[entry_capacity];
+    for (s32 i = 0; i < mEntryNum; i++)
+        entries[i] = mEntries[i];
+    delete[] mEntries;
+    mEntries = entries;
+    mEntryCapacity = entry_capacity;
+
+    s32 node_capacity = entry_capacity * 2;
+    Node* nodes = new Node[node_capacity];
+    for (s32 i = 0; i < mNodeCapacity; i++)
+        nodes[i] = mNodes[i];
+    for (s32 i = mNodeCapacity; i < node_capacity; i++) {
+        nodes[i].parent = i + 1 < node_capacity ? i + 1 : mFreeNode;
+        nodes[i].height = -1;
+    }
+    mFreeNode = mNodeCapacity;
+    delete[] mNodes;
+    mNodes = nodes;
+    mNodeCapacity = node_capacity;
+
+    delete[] mEntryTable;
+    mEntryTableSize *= 2;
+    mEntryTable = new s32[mEntryTableSize];
+    for (s32 i = 0; i < mEntryTableSize; i++)
+        mEntryTable[i] = -1;
+    for (s32 i = 0; i < mEntryNum; i++)
+        addEntryTable(i);
+}
+
+void CollisionPartsKeeperAabbTree::connectEntry(s32 index) {
+    Entry& entry = mEntries[index];
+    if (entry.leafNode >= 0)
+        return;
+
+    s32 leaf = allocateNode();
+    if (leaf < 0)
+        return;
+
+    sead::Vector3f center;
+    f32 range;
+    calcPartsSphere(&center, &range, entry.parts);
+    f32 extent = range + cBoxMargin;
+    Node& node = mNodes[leaf];
+    node.min.set(center.x - extent, center.y - extent, center.z - extent);
+    node.max.set(center.x + extent, center.y + extent, center.z + extent);
+    node.entryIndex = index;
+    entry.leafNode = leaf;
+    insertLeaf(leaf);
+}
+
+void CollisionPartsKeeperAabbTree::disconnectEntry(s32 index) {
+    Entry& entry = mEntries[index];
+    if (entry.leafNode < 0)
+        return;
+
+    removeLeaf(entry.leafNode);
+    freeNode(entry.leafNode);
+    entry.leafNode = -1;
+}
+
+// Moves the leaf of the parts only once they have left its box. The new box is stretched in the
+// direction of the last move, so parts moving steadily keep their leaf for a few frames.
+bool CollisionPartsKeeperAabbTree::updateEntry(s32 index) {
+    const Entry& entry = mEntries[index];
+    sead::Vector3f center;
+    f32 range;
+    calcPartsSphere(&center, &range, entry.parts);
+    sead::Vector3f min = {center.x - range, center.y - range, center.z - range};
+    sead::Vector3f max = {center.x + range, center.y + range, center.z + range};
+
+    Node& node = mNodes[entry.leafNode];
+    if (isInsideBox(min, max, node.min, node.max))
+        return false;
+
+    removeLeaf(entry.leafNode);
+
+    sead::Vector3f prev_center;
+    entry.parts->getPrevBaseMtx().getTranslation(prev_center);
+    sead::Vector3f move = (center - prev_center) * cMovePredictFrames;
+    f32 extent = range + cBoxMargin;
+    node.min.set(center.x - extent + sead::Mathf::min(move.x, 0.0f),
+                 center.y - extent + sead::Mathf::min(move.y, 0.0f),
+                 center.z - extent + sead::Mathf::min(move.z, 0.0f));
+    node.max.set(center.x + extent + sead::Mathf::max(move.x, 0.0f),
+                 center.y + extent + sead::Mathf::max(move.y, 0.0f),
+                 center.z + extent + sead::Mathf::max(move.z, 0.0f));
+
+    insertLeaf(entry.leafNode);
+    return true;
+}
+
+s32 CollisionPartsKeeperAabbTree::allocateNode() {
+    if (mFreeNode < 0)
+        return -1;
+
+    s32 index = mFreeNode;
+    Node& node = mNodes[index];
+    mFreeNode = node.parent;
+    node.parent = -1;
+    node.child1 = -1;
+    node.child2 = -1;
+    node.height = 0;
+    node.entryIndex = -1;
+    return index;
+}
+
+void CollisionPartsKeeperAabbTree::freeNode(s32 index) {
+    mNodes[index].parent = mFreeNode;
+    mNodes[index].height = -1;
+    mFreeNode = index;
+}
+
+// Walks down to the sibling that grows the total box surface the least, then pairs the leaf with
+// it under a new node.
+void CollisionPartsKeeperAabbTree::insertLeaf(s32 leaf) {
+    if (mRootNode < 0) {
+        mRootNode = leaf;
+        mNodes[leaf].parent = -1;
+        return;
+    }
+
+    const sead::Vector3f& leaf_min = mNodes[leaf].min;
+    const sead::Vector3f& leaf_max = mNodes[leaf].max;
+    s32 index = mRootNode;
+    while (!mNodes[index].isLeaf()) {
+        const Node& node = mNodes[index];
+        f32 surface = calcBoxSurface(node.min, node.max);
+        f32 merged_surface = calcMergedSurface(node.min, node.max, leaf_min, leaf_max);
+        f32 cost = 2.0f * merged_surface;
+        f32 inheritance_cost = 2.0f * (merged_surface - surface);
+
+        f32 child_cost[2];
+        const s32 children[2] = {node.child1, node.child2};
+        for (s32 i = 0; i < 2; i++) {
+            const Node& child = mNodes[children[i]];
+            child_cost[i] = calcMergedSurface(child.min, child.max, leaf_min, leaf_max) +
+                            inheritance_cost;
+            if (!child.isLeaf())
+                child_cost[i] -= calcBoxSurface(child.min, child.max);
+        }
+
+        if (cost < child_cost[0] && cost < child_cost[1])
+            break;
+        index = child_cost[0] < child_cost[1] ? children[0] : children[1];
+    }
+
+    s32 sibling = index;
+    s32 old_parent = mNodes[sibling].parent;
+    s32 new_parent = allocateNode();
+    Node& parent_node = mNodes[new_parent];
+    parent_node.parent = old_parent;
+    parent_node.height = mNodes[sibling].height + 1;
+    parent_node.child1 = sibling;
+    parent_node.child2 = leaf;
+    mergeBox(&parent_node.min, &parent_node.max, leaf_min, leaf_max, mNodes[sibling].min,
+             mNodes[sibling].max);
+    mNodes[sibling].parent = new_parent;
+    mNodes[leaf].parent = new_parent;
+
+    if (old_parent < 0)
+        mRootNode = new_parent;
+    else if (mNodes[old_parent].child1 == sibling)
+        mNodes[old_parent].child1 = new_parent;
+    else
+        mNodes[old_parent].child2 = new_parent;
+
+    refitNode(mNodes[leaf].parent);
+}
+
+void CollisionPartsKeeperAabbTree::removeLeaf(s32 leaf) {
+    if (leaf == mRootNode) {
+        mRootNode = -1;
+        return;
+    }
+
+    s32 parent = mNodes[leaf].parent;
+    s32 grand_parent = mNodes[parent].parent;
+    s32 sibling = mNodes[parent].child1 == leaf ? mNodes[parent].child2 : mNodes[parent].child1;
+
+    mNodes[sibling].parent = grand_parent;
+    freeNode(parent);
+    if (grand_parent < 0) {
+        mRootNode = sibling;
+        return;
+    }
+
+    if (mNodes[grand_parent].child1 == parent)
+        mNodes[grand_parent].child1 = sibling;
+    else
+        mNodes[grand_parent].child2 = sibling;
+    refitNode(grand_parent);
+}
+
+void CollisionPartsKeeperAabbTree::refitNode(s32 index) {
+    while (index >= 0) {
+        index = balance(index);
+        Node& node = mNodes[index];
+        const Node& child1 = mNodes[node.child1];
+        const Node& child2 = mNodes[node.child2];
+        node.height = 1 + (child1.height > child2.height ? child1.height : child2.height);
+        mergeBox(&node.min, &node.max, child1.min, child1.max, child2.min, child2.max);
+        index = node.parent;
+    }
+}
+
+// Rotates the higher child of the node up when the heights of its children differ by more than
+// one. Returns the node now in its place.
+s32 CollisionPartsKeeperAabbTree::balance(s32 index) {
+    Node& node = mNodes[index];
+    if (node.isLeaf() || node.height < 2)
+        return index;
+
+    s32 lower = node.child1;
+    s32 higher = node.child2;
+    s32 diff = mNodes[node.child2].height - mNodes[node.child1].height;
+    if (diff < 0) {
+        lower = node.child2;
+        higher = node.child1;
+        diff = -diff;
+    }
+    if (diff <= 1)
+        return index;
+
+    // the higher child takes the place of the node, which keeps the lower child and the lower
+    // grandchild and becomes a child of the higher one next to the higher grandchild
+    Node& up = mNodes[higher];
+    s32 grand_child1 = up.child1;
+    s32 grand_child2 = up.child2;
+    s32 keep = grand_child1;
+    s32 move = grand_child2;
+    if (mNodes[grand_child1].height < mNodes[grand_child2].height) {
+        keep = grand_child2;
+        move = grand_child1;
+    }
+
+    up.parent = node.parent;
+    if (up.parent < 0)
+        mRootNode = higher;
+    else if (mNodes[up.parent].child1 == index)
+        mNodes[up.parent].child1 = higher;
+    else
+        mNodes[up.parent].child2 = higher;
+
+    up.child1 = index;
+    up.child2 = keep;
+    node.parent = higher;
+    node.child1 = lower;
+    node.child2 = move;
+    mNodes[move].parent = index;
+
+    const Node& lower_node = mNodes[lower];
+    const Node& move_node = mNodes[move];
+    const Node& keep_node = mNodes[keep];
+    mergeBox(&node.min, &node.max, lower_node.min, lower_node.max, move_node.min, move_node.max);
+    node.height = 1 + (lower_node.height > move_node.height ? lower_node.height : move_node.height);
+    mergeBox(&up.min, &up.max, node.min, node.max, keep_node.min, keep_node.max);
+    up.height = 1 + (node.height > keep_node.height ? node.height : keep_node.height);
+    return higher;
+}
+
+}  // namespace al
+
+#endif
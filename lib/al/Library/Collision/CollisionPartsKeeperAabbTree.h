@@ -0,0 +1,86 @@
+#pragma once
+
+#ifdef AL_COLLISION_AABB_TREE
+
+#include <math/seadVector.h>
+
+#include "Library/Collision/ICollisionPartsKeeper.h"
+
+namespace al {
+class CollisionParts;
+
+// Keeps the bounding boxes of the connected parts in a dynamic AABB tree. Every leaf holds a box
+// grown by a margin, so parts that move a little stay in their leaf. Only moving parts that leave
+// their box are removed and inserted again, and the tree is rebalanced on the way up.
+// LiveActorKit makes it the active keeper of CollisionDirector in builds with
+// AL_COLLISION_AABB_TREE, so it only gets parts and queries through mActivePartsKeeper. The code
+// that adds and connects parts and the strike queries are not decompiled yet, so nothing calls
+// it so far. The arrays grow when more parts are added than it was created for.
+class CollisionPartsKeeperAabbTree : public ICollisionPartsKeeper {
+public:
+    CollisionPartsKeeperAabbTree(s32 partsNumMax);
+    ~CollisionPartsKeeperAabbTree();
+
+    void endInit() override;
+    void addCollisionParts(CollisionParts* parts) override;
+    void connectToCollisionPartsList(CollisionParts* parts) override;
+    void disconnectToCollisionPartsList(CollisionParts* parts) override;
+    void resetToCollisionPartsList(CollisionParts* parts) override;
+    void searchWithSphere(const sead::Vector3f& pos, f32 radius,
+                          sead::IDelegate1<CollisionParts*>& callback) override;
+    void movement() override;
+
+    void searchWithArrow(const sead::Vector3f& pos, const sead::Vector3f& dir,
+                         sead::IDelegate1<CollisionParts*>& callback);
+
+    s32 getPartsNum() const { return mEntryNum; }
+
+    s32 getTreeHeight() const { return mRootNode < 0 ? 0 : mNodes[mRootNode].height; }
+
+private:
+    struct Node {
+        sead::Vector3f min;
+        sead::Vector3f max;
+        s32 parent;  // next free node while unused
+        s32 child1;
+        s32 child2;
+        s32 height;  // -1 while unused, 0 for leaves
+        s32 entryIndex;
+
+        bool isLeaf() const { return child1 < 0; }
+    };
+
+    struct Entry {
+        CollisionParts* parts;
+        s32 leafNode;  // -1 while disconnected
+    };
+
+    template <typename Query>
+    void searchTree(const Query& query, sead::IDelegate1<CollisionParts*>& callback) const;
+    s32 findEntry(const CollisionParts* parts) const;
+    void addEntryTable(s32 index);
+    void grow();
+    void connectEntry(s32 index);
+    void disconnectEntry(s32 index);
+    bool updateEntry(s32 index);
+    s32 allocateNode();
+    void freeNode(s32 index);
+    void insertLeaf(s32 leaf);
+    void removeLeaf(s32 leaf);
+    s32 balance(s32 index);
+    void refitNode(s32 index);
+
+    Node* mNodes = nullptr;
+    s32 mNodeCapacity;
+    s32 mFreeNode = 0;
+    s32 mRootNode = -1;
+    Entry* mEntries = nullptr;
+    s32 mEntryNum = 0;
+    s32 mEntryCapacity;
+    // entry indices by parts address, open addressing with -1 for free slots
+    s32* mEntryTable = nullptr;
+    s32 mEntryTableSize = 0;
+};
+}  // namespace al
+
+#endif
@@ -0,0 +1,23 @@
+#pragma once
+
+#include <math/seadVector.h>
+#include <prim/seadDelegate.h>
+
+namespace al {
+class CollisionParts;
+
+class ICollisionPartsKeeper {
+public:
+    virtual void endInit() = 0;
+    virtual void addCollisionParts(CollisionParts* parts) = 0;
+    virtual void connectToCollisionPartsList(CollisionParts* parts) = 0;
+    virtual void disconnectToCollisionPartsList(CollisionParts* parts) = 0;
+    virtual void resetToCollisionPartsList(CollisionParts* parts) = 0;
+    virtual void searchWithSphere(const sead::Vector3f& pos, f32 radius,
+                                  sead::IDelegate1<CollisionParts*>& callback) = 0;
+    virtual void movement() = 0;
+
+    // not known from the game, last so that the slots above keep their order
+    virtual ~ICollisionPartsKeeper() = default;
+};
+}  // namespace al
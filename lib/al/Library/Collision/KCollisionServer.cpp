@@ -1,9 +1,367 @@
 #include "Library/Collision/KCollisionServer.h"
 
+#include <math/seadMathCalcCommon.h>
+
+#ifdef __aarch64__
+#include <arm_neon.h>
+#endif
+
 #include "Library/Math/MathUtil.h"
 
 namespace al {
 
+namespace {
+constexpr s32 cSphereBatchMax = KCSphereBatchBuffer::cSphereNumMax;
+constexpr s32 cCandidateMax = KCSphereBatchBuffer::cCandidateNumMax;
+constexpr s32 cVisitedTableSize = KCPrismVisitedBuffer::cTableSize;
+
+// Open addressing over the table of a KCPrismVisitedBuffer. Once three quarters of it are used,
+// the prisms move to a table twice as large on the current heap, which is freed at the end.
+class PrismVisitedTable {
+public:
+    PrismVisitedTable(KCPrismVisitedBuffer* buffer)
+        : mBuffer(buffer), mTable(buffer->table), mTableSize(cVisitedTableSize) {}
+
+    ~PrismVisitedTable() {
+        if (mTable != mBuffer->table)
+            delete[] mTable;
+        for (s32 i = 0; i < mUsedSlotNum; i++)
+            mBuffer->table[mBuffer->usedSlots[i]] = nullptr;
+    }
+
+    bool tryVisit(const KCPrismData* data) {
+        u32 slot = findSlot(mTable, mTableSize, data);
+        if (mTable[slot] == data)
+            return false;
+
+        if ((mVisitedNum + 1) * 4 > mTableSize * 3) {
+            grow();
+            slot = findSlot(mTable, mTableSize, data);
+        }
+        mTable[slot] = data;
+        if (mTable == mBuffer->table)
+            mBuffer->usedSlots[mUsedSlotNum++] = slot;
+        mVisitedNum++;
+        return true;
+    }
+
+private:
+    static u32 findSlot(const KCPrismData* const* table, s32 tableSize, const KCPrismData* data) {
+        u32 mask = tableSize - 1;
+        u32 slot = (reinterpret_cast<uintptr_t>(data) >> 2) & mask;
+        while (table[slot] && table[slot] != data)
+            slot = (slot + 1) & mask;
+        return slot;
+    }
+
+    void grow() {
+        s32 table_size = mTableSize * 2;
+        const KCPrismData** table = new const KCPrismData*[table_size];
+        for (s32 i = 0; i < table_size; i++)
+            table[i] = nullptr;
+        for (s32 i = 0; i < mTableSize; i++)
+            if (mTable[i])
+                table[findSlot(table, table_size, mTable[i])] = mTable[i];
+
+        if (mTable != mBuffer->table)
+            delete[] mTable;
+        mTable = table;
+        mTableSize = table_size;
+    }
+
+    KCPrismVisitedBuffer* mBuffer;
+    const KCPrismData** mTable;
+    s32 mTableSize;
+    s32 mVisitedNum = 0;
+    s32 mUsedSlotNum = 0;
+};
+
+// Collects the prisms found by searchPrismMinMax, skipping the ones already collected.
+class PrismCandidateCollector {
+public:
+    PrismCandidateCollector(KCollisionServer* server, KCSphereBatchBuffer* buffer, s32 sphereNum,
+                            const sead::Vector3f* positions, const f32* radii, f32 unk,
+                            sead::FixedRingBuffer<KCHitInfo, 512>* hitsList)
+        : mServer(server), mBuffer(buffer), mSphereNum(sphereNum), mPositions(positions),
+          mRadii(radii), mUnk(unk), mHitsList(hitsList), mVisitedTable(&buffer->visited) {}
+
+    void add(const KCPrismData* data, const KCPrismHeader* header) {
+        if (!mVisitedTable.tryVisit(data))
+            return;
+
+        mBuffer->candidateData[mCandidateNum] = data;
+        mBuffer->candidateHeader[mCandidateNum] = header;
+        if (++mCandidateNum == cCandidateMax)
+            flush();
+    }
+
+    void flush() {
+        for (s32 i = 0; i < mCandidateNum; i++)
+            testCandidate(mBuffer->candidateData[i], mBuffer->candidateHeader[i]);
+        mCandidateNum = 0;
+    }
+
+    s32 getHitNum() const { return mHitNum; }
+
+private:
+    void testCandidate(const KCPrismData* data, const KCPrismHeader* header);
+    void testSphere(const KCPrismData* data, const KCPrismHeader* header, s32 index);
+
+    KCollisionServer* mServer;
+    KCSphereBatchBuffer* mBuffer;
+    s32 mSphereNum;
+    const sead::Vector3f* mPositions;
+    const f32* mRadii;
+    f32 mUnk;
+    sead::FixedRingBuffer<KCHitInfo, 512>* mHitsList;
+    PrismVisitedTable mVisitedTable;
+    s32 mCandidateNum = 0;
+    s32 mHitNum = 0;
+};
+
+void PrismCandidateCollector::testSphere(const KCPrismData* data, const KCPrismHeader* header,
+                                         s32 index) {
+    f32 distance = 0.0f;
+    u8 location = 0;
+    if (!mServer->KCHitSphere(data, header, &mPositions[index], mRadii[index], mUnk, &distance,
+                              &location))
+        return;
+
+    KCHitInfo hit;
+    hit.mHeader = header;
+    hit.mData = data;
+    hit._16 = distance;
+    hit._20 = location;
+    if (mHitsList[index].pushBack(hit))
+        mHitNum++;
+}
+
+// Rejects spheres that lie entirely outside the face plane or one of the three edge planes of
+// the prism, four spheres per step. Only the remaining ones go through KCHitSphere, which still
+// decides every hit. The dot products are separate multiplies and adds like the scalar ones, so
+// both paths reject the same spheres.
+void PrismCandidateCollector::testCandidate(const KCPrismData* data,
+                                            const KCPrismHeader* header) {
+    const sead::Vector3f& pos = mServer->getVertexData(data->mPosIndex, header);
+    const sead::Vector3f& face = mServer->getFaceNormal(data, header);
+    const sead::Vector3f& edge1 = mServer->getEdgeNormal1(data, header);
+    const sead::Vector3f& edge2 = mServer->getEdgeNormal2(data, header);
+    const sead::Vector3f& edge3 = mServer->getEdgeNormal3(data, header);
+    const KCSphereBatchBuffer& batch = *mBuffer;
+
+    s32 i = 0;
+#ifdef __aarch64__
+    for (; i + 4 <= mSphereNum; i += 4) {
+        float32x4_t dx = vsubq_f32(vld1q_f32(&batch.x[i]), vdupq_n_f32(pos.x));
+        float32x4_t dy = vsubq_f32(vld1q_f32(&batch.y[i]), vdupq_n_f32(pos.y));
+        float32x4_t dz = vsubq_f32(vld1q_f32(&batch.z[i]), vdupq_n_f32(pos.z));
+        float32x4_t radius = vld1q_f32(&batch.radius[i]);
+
+        auto dot = [&](const sead::Vector3f& n) {
+            float32x4_t d = vmulq_n_f32(dx, n.x);
+            d = vaddq_f32(d, vmulq_n_f32(dy, n.y));
+            return vaddq_f32(d, vmulq_n_f32(dz, n.z));
+        };
+
+        uint32x4_t is_near = vcleq_f32(dot(face), radius);
+        is_near = vandq_u32(is_near, vcleq_f32(dot(edge1), radius));
+        is_near = vandq_u32(is_near, vcleq_f32(dot(edge2), radius));
+        is_near = vandq_u32(is_near,
+                            vcleq_f32(dot(edge3), vaddq_f32(radius, vdupq_n_f32(data->mLength))));
+        if (vmaxvq_u32(is_near) == 0)
+            continue;
+
+        u32 lanes[4];
+        vst1q_u32(lanes, is_near);
+        for (s32 j = 0; j < 4; j++)
+            if (lanes[j])
+                testSphere(data, header, i + j);
+    }
+#endif
+    for (; i < mSphereNum; i++) {
+        sead::Vector3f diff = {batch.x[i] - pos.x, batch.y[i] - pos.y, batch.z[i] - pos.z};
+        f32 radius = batch.radius[i];
+        if (diff.dot(face) > radius || diff.dot(edge1) > radius || diff.dot(edge2) > radius ||
+            diff.dot(edge3) > radius + data->mLength)
+            continue;
+        testSphere(data, header, i);
+    }
+}
+
+bool isFinite(f32 value) {
+    return value - value == 0.0f;
+}
+
+bool isFinite(const sead::Vector3f& vec) {
+    return isFinite(vec.x) && isFinite(vec.y) && isFinite(vec.z);
+}
+
+// Octree leaves hold a list of prism indices ended by this value, the KCL v2 layout that
+// tools/kcl-tool.py documents.
+constexpr u16 cPrismListEnd = 0xFFFF;
+}  // namespace
+
+KCPrismVisitedBuffer::KCPrismVisitedBuffer() {
+    for (s32 i = 0; i < cTableSize; i++)
+        table[i] = nullptr;
+}
+
+// Checks several spheres at once, each with its own hit buffer in hitsList. The octree is walked
+// once for the bounds of all spheres and every prism found is tested against all of them. There
+// is nothing in place of the u32 of checkSphere, whose use is unknown, and hits are only limited
+// by the size of the buffers.
+s32 KCollisionServer::checkSphereBatch(const sead::Vector3f* positions, const f32* radii,
+                                       s32 sphereNum, f32 unk,
+                                       sead::FixedRingBuffer<KCHitInfo, 512>* hitsList,
+                                       KCSphereBatchBuffer* buffer) {
+    if (sphereNum > cSphereBatchMax) {
+        s32 hitNum = checkSphereBatch(positions, radii, cSphereBatchMax, unk, hitsList, buffer);
+        return hitNum + checkSphereBatch(&positions[cSphereBatchMax], &radii[cSphereBatchMax],
+                                         sphereNum - cSphereBatchMax, unk,
+                                         &hitsList[cSphereBatchMax], buffer);
+    }
+    if (sphereNum <= 0)
+        return 0;
+
+    sead::Vector3f min = positions[0];
+    sead::Vector3f max = positions[0];
+    for (s32 i = 0; i < sphereNum; i++) {
+        // the margin keeps the plane tests conservative for any use of the extra parameter
+        f32 margin = radii[i] + sead::Mathf::abs(unk);
+        buffer->x[i] = positions[i].x;
+        buffer->y[i] = positions[i].y;
+        buffer->z[i] = positions[i].z;
+        buffer->radius[i] = margin;
+
+        min.x = sead::Mathf::min(min.x, positions[i].x - margin);
+        min.y = sead::Mathf::min(min.y, positions[i].y - margin);
+        min.z = sead::Mathf::min(min.z, positions[i].z - margin);
+        max.x = sead::Mathf::max(max.x, positions[i].x + margin);
+        max.y = sead::Mathf::max(max.y, positions[i].y + margin);
+        max.z = sead::Mathf::max(max.z, positions[i].z + margin);
+    }
+
+    PrismCandidateCollector collector(this, buffer, sphereNum, positions, radii, unk, hitsList);
+    sead::Delegate2<PrismCandidateCollector, const KCPrismData*, const KCPrismHeader*> callback(
+        &collector, &PrismCandidateCollector::add);
+    searchPrismMinMax(min, max, callback);
+    collector.flush();
+    return collector.getHitNum();
+}
+
+// Not a function of the game. It is an alternative to searchPrismArrow, whose code is not known:
+// it walks the octree leaves the arrow passes through, in order along the arrow, and reports every
+// prism in them once. From each leaf it steps into the neighbour behind the face the arrow leaves
+// through, so no leaf off the arrow is visited. The walk ends once the arrow is past the fraction
+// the callback still asks for. Arrows that are not finite are ignored, and every step moves on by
+// at least one block on one axis, so the walk ends after at most as many steps as the area has
+// blocks along its three axes.
+// searchBlock is not decompiled either. This assumes it returns the prism index list of the leaf
+// that holds the block and the width of that leaf as a shift, as in the KCL v2 layout. A prism
+// list stops at the first index that is out of range.
+void KCollisionServer::marchPrismArrowLeaves(const sead::Vector3f& pos1, const sead::Vector3f& pos2,
+                                             KCArrowSearchCallback& callback,
+                                             KCPrismVisitedBuffer* visitedBuffer) const {
+    if (!isFinite(pos1) || !isFinite(pos2))
+        return;
+
+    PrismVisitedTable visited_table(visitedBuffer);
+    f32 limit = 1.0f;
+
+    for (u32 i = 0; i < getNumInnerKcl(); i++) {
+        const KCPrismHeader* header = &getInnerKcl(i);
+        sead::Vector3f area_start;
+        sead::Vector3f area_end;
+        sead::Vector3f area_size;
+        objectSpaceToAreaOffsetSpaceV3f(&area_start, pos1, header);
+        objectSpaceToAreaOffsetSpaceV3f(&area_end, pos2, header);
+        getAreaSpaceSize(&area_size, header);
+        if (!isFinite(area_start) || !isFinite(area_end))
+            continue;
+
+        const f32 start[3] = {area_start.x, area_start.y, area_start.z};
+        const f32 dir[3] = {area_end.x - area_start.x, area_end.y - area_start.y,
+                            area_end.z - area_start.z};
+        const f32 size[3] = {area_size.x, area_size.y, area_size.z};
+        const u32 triangle_num = getTriangleNum(header);
+
+        // clip the arrow to the area of this model
+        f32 t_min = 0.0f;
+        f32 t_max = limit;
+        for (s32 axis = 0; axis < 3; axis++) {
+            if (dir[axis] == 0.0f) {
+                if (start[axis] < 0.0f || start[axis] >= size[axis])
+                    t_min = t_max + 1.0f;
+                continue;
+            }
+            f32 t_0 = -start[axis] / dir[axis];
+            f32 t_1 = (size[axis] - start[axis]) / dir[axis];
+            t_min = sead::Mathf::max(t_min, sead::Mathf::min(t_0, t_1));
+            t_max = sead::Mathf::min(t_max, sead::Mathf::max(t_0, t_1));
+        }
+        if (!(t_min <= t_max))
+            continue;
+
+        u32 cell[3];
+        for (s32 axis = 0; axis < 3; axis++) {
+            f32 pos = sead::Mathf::clamp(start[axis] + dir[axis] * t_min, 0.0f, size[axis] - 1.0f);
+            cell[axis] = static_cast<u32>(pos);
+        }
+
+        u32 step_num = static_cast<u32>(size[0] + size[1] + size[2]);
+        for (u32 step = 0; step <= step_num; step++) {
+            s32 width_shift = 0;
+            const u8* block = searchBlock(&width_shift, {cell[0], cell[1], cell[2]}, header);
+            if (block) {
+                for (const u16* index = reinterpret_cast<const u16*>(block);
+                     *index != cPrismListEnd && *index < triangle_num; index++) {
+                    const KCPrismData* data = &getPrismData(*index, header);
+                    if (visited_table.tryVisit(data))
+                        limit = sead::Mathf::min(limit, callback.visitPrism(data, header));
+                }
+                t_max = sead::Mathf::min(t_max, limit);
+            }
+
+            u32 width = 1u << width_shift;
+            f32 t_exit[3];
+            f32 t_next = t_max;
+            for (s32 axis = 0; axis < 3; axis++) {
+                u32 base = cell[axis] & ~(width - 1);
+                if (dir[axis] > 0.0f)
+                    t_exit[axis] = (base + width - start[axis]) / dir[axis];
+                else if (dir[axis] < 0.0f)
+                    t_exit[axis] = (base - start[axis]) / dir[axis];
+                else
+                    t_exit[axis] = t_max;
+                t_next = sead::Mathf::min(t_next, t_exit[axis]);
+            }
+            if (t_next >= t_max)
+                break;
+
+            bool is_outside = false;
+            for (s32 axis = 0; axis < 3; axis++) {
+                u32 base = cell[axis] & ~(width - 1);
+                if (t_exit[axis] != t_next) {
+                    // stay within the slab of the current leaf on the axes the arrow does not
+                    // leave through, and never step back against the arrow
+                    f32 pos = start[axis] + dir[axis] * t_next;
+                    u32 next = static_cast<u32>(sead::Mathf::clamp(pos, base, base + width - 1));
+                    if (dir[axis] > 0.0f ? next > cell[axis] : next < cell[axis])
+                        cell[axis] = next;
+                    continue;
+                }
+                // the previous leaf along a negative direction ends right below the base, which
+                // wraps around at 0 and is caught by the size check
+                cell[axis] = dir[axis] > 0.0f ? base + width : base - 1;
+                if (cell[axis] >= size[axis])
+                    is_outside = true;
+            }
+            if (is_outside)
+                break;
+        }
+    }
+}
+
 void SphereInterpolator::startInterp(const sead::Vector3f& posStart, const sead::Vector3f& posEnd,
                                      f32 sizeStart, f32 sizeEnd, f32 steps) {
     mCurrentStep = 0.0f;
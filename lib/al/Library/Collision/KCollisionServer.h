@@ -39,6 +39,41 @@ struct KCHitInfo {
     u8 _20;  // collision location, enum
 };
 
+// Prisms already reported to a search, hashed by address. The table is empty between searches:
+// a search clears the slots it used when it ends. Searches that report more prisms than fit at
+// three quarters load move on to a larger table on the current heap.
+struct KCPrismVisitedBuffer {
+    static constexpr s32 cTableSize = 1024;
+    static constexpr s32 cUsedSlotNumMax = cTableSize / 4 * 3;
+
+    KCPrismVisitedBuffer();
+
+    const KCPrismData* table[cTableSize];
+    u16 usedSlots[cUsedSlotNumMax];
+};
+
+// Work area of KCollisionServer::checkSphereBatch, about 12KB. Callers keep one around instead of
+// the query putting it on the stack.
+struct KCSphereBatchBuffer {
+    static constexpr s32 cSphereNumMax = 32;
+    static constexpr s32 cCandidateNumMax = 128;
+
+    f32 x[cSphereNumMax];
+    f32 y[cSphereNumMax];
+    f32 z[cSphereNumMax];
+    f32 radius[cSphereNumMax];
+    const KCPrismData* candidateData[cCandidateNumMax];
+    const KCPrismHeader* candidateHeader[cCandidateNumMax];
+    KCPrismVisitedBuffer visited;
+};
+
+class KCArrowSearchCallback {
+public:
+    // Returns the fraction of the arrow that is still of interest, so that a hit can end the
+    // search early. Returning 1.0f keeps searching the whole arrow.
+    virtual f32 visitPrism(const KCPrismData* data, const KCPrismHeader* header) = 0;
+};
+
 class KCollisionServer {
 public:
     KCollisionServer();
@@ -64,6 +99,9 @@ public:
                           const KCPrismHeader* header) const;
     s32 checkSphere(const sead::Vector3f*, f32, f32, u32,
                     sead::FixedRingBuffer<KCHitInfo, 512>* hits);  // TODO unknown parameter usage
+    s32 checkSphereBatch(const sead::Vector3f* positions, const f32* radii, s32 sphereNum, f32 unk,
+                         sead::FixedRingBuffer<KCHitInfo, 512>* hitsList,
+                         KCSphereBatchBuffer* buffer);
     bool outCheckAndCalcArea(sead::Vector3u* blockMin, sead::Vector3u* blockMax,
                              const sead::Vector3f& posMin, const sead::Vector3f& posMax,
                              const KCPrismHeader* header) const;
@@ -94,6 +132,9 @@ public:
                            sead::IDelegate2<const KCPrismData*, const KCPrismHeader*>& callback);
     void searchPrismArrow(const sead::Vector3f& pos1, const sead::Vector3f& pos2,
                           sead::IDelegate2<const KCPrismData*, const KCPrismHeader*>& callback);
+    void marchPrismArrowLeaves(const sead::Vector3f& pos1, const sead::Vector3f& pos2,
+                               KCArrowSearchCallback& callback,
+                               KCPrismVisitedBuffer* visitedBuffer) const;
     void searchPrismDisk(const sead::Vector3f&, const sead::Vector3f&, f32, f32,
                          sead::IDelegate2<const KCPrismData*, const KCPrismHeader*>&
                              callback);  // TODO unknown parameter usage
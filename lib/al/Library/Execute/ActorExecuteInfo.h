@@ -13,6 +13,8 @@ public:
     void addUpdater(ExecutorActorExecuteBase* updater);
     void addDrawer(ModelDrawerBase* drawer);
 
+    ExecuteRequestKeeper* getRequestKeeper() const { return mRequestKeeper; }
+
 private:
     ExecuteRequestKeeper* mRequestKeeper = nullptr;
     s32 mUpdaterCount = 0;
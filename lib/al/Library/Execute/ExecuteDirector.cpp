@@ -1,15 +1,19 @@
 #include "Library/Execute/ExecuteDirector.h"
 
-#include "Library/Base/StringUtil.h"
 #include "Library/Execute/ActorExecuteInfo.h"
+#include "Library/Execute/ExecuteNameMap.h"
 #include "Library/Execute/ExecuteRequestKeeper.h"
 #include "Library/Execute/ExecuteTablesImpl.h"
 #include "Library/Execute/LayoutExecuteInfo.h"
 #include "Library/Layout/LayoutActor.h"
 #include "Library/LiveActor/LiveActor.h"
+#include "Library/Nerve/NerveTrace.h"
 
 namespace al {
 
+ExecuteNameMap* ExecuteDirector::sTableNameMap = nullptr;
+ExecuteNameMap* ExecuteDirector::sListNameMap = nullptr;
+
 ExecuteDirector::ExecuteDirector(s32 count) : mRequestCount(count){};
 
 ExecuteDirector::~ExecuteDirector() {
@@ -20,6 +24,7 @@ ExecuteDirector::~ExecuteDirector() {
         delete mUpdateTables[i];
 }
 
+// NON_MATCHING: the first director also builds the name maps every director shares
 void ExecuteDirector::init(const ExecuteSystemInitInfo& initInfo) {
     mUpdateTableCount = UpdateTableSize;
     mUpdateTables = new ExecuteTableHolderUpdate*[UpdateTableSize];
@@ -40,21 +45,53 @@ void ExecuteDirector::init(const ExecuteSystemInitInfo& initInfo) {
     }
 
     mRequestKeeper = new ExecuteRequestKeeper(mRequestCount);
+
+    if (sTableNameMap)
+        return;
+
+    // the maps are kept for the rest of the run, like the tables they are built from
+    static_assert(UpdateTableSize <= 64 && DrawTableSize <= 64);
+    sTableNameMap = new ExecuteNameMap(UpdateTableSize + DrawTableSize);
+    sListNameMap = new ExecuteNameMap(sizeof(updateTableArr) / sizeof(updateTableArr[0]) +
+                                      sizeof(drawTableArr) / sizeof(drawTableArr[0]));
+
+    for (s32 i = 0; i < UpdateTableSize; i++) {
+        sTableNameMap->addUpdateTable(UpdateTable[i].mName, i);
+        for (s32 j = 0; j < UpdateTable[i].mExecuteOrderCount; j++)
+            sListNameMap->addUpdateTable(UpdateTable[i].mExecuteOrders[j].mListName, i);
+    }
+
+    for (s32 i = 0; i < DrawTableSize; i++) {
+        sTableNameMap->addDrawTable(DrawTable[i].mName, i);
+        for (s32 j = 0; j < DrawTable[i].mExecuteOrderCount; j++)
+            sListNameMap->addDrawTable(DrawTable[i].mExecuteOrders[j].mListName, i);
+    }
+}
+
+s32 ExecuteDirector::findUpdateTableIndex(const char* tableName) const {
+    u64 mask = sTableNameMap->findUpdateTableMask(tableName);
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
+}
+
+s32 ExecuteDirector::findDrawTableIndex(const char* tableName) const {
+    u64 mask = sTableNameMap->findDrawTableMask(tableName);
+    return mask != 0 ? __builtin_ctzll(mask) : -1;
 }
 
 void ExecuteDirector::registerActorUpdate(LiveActor* actor, const char* listName) {
     if (!actor->getExecuteInfo())
         actor->initExecuteInfo(new ActorExecuteInfo(mRequestKeeper));
 
-    for (s32 i = 0; i < mUpdateTableCount; i++)
-        mUpdateTables[i]->tryRegisterActor(actor, listName);
+    for (u64 mask = sListNameMap->findUpdateTableMask(listName); mask != 0; mask &= mask - 1)
+        mUpdateTables[__builtin_ctzll(mask)]->tryRegisterActor(actor, listName);
 }
 
 void ExecuteDirector::registerActorDraw(LiveActor* actor, const char* listName) {
     if (!actor->getExecuteInfo())
         actor->initExecuteInfo(new ActorExecuteInfo(mRequestKeeper));
 
-    for (s32 i = 0; i < mDrawTableCount; i++) {
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1) {
+        s32 i = __builtin_ctzll(mask);
         mDrawTables[i]->tryRegisterActor(actor, listName);
         mDrawTables[i]->tryRegisterActorModel(actor, listName);
     }
@@ -64,45 +101,45 @@ void ExecuteDirector::registerActorModelDraw(LiveActor* actor, const char* listN
     if (!actor->getExecuteInfo())
         actor->initExecuteInfo(new ActorExecuteInfo(mRequestKeeper));
 
-    for (s32 i = 0; i < mDrawTableCount; i++)
-        mDrawTables[i]->tryRegisterActorModel(actor, listName);
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1)
+        mDrawTables[__builtin_ctzll(mask)]->tryRegisterActorModel(actor, listName);
 }
 
 void ExecuteDirector::registerLayoutUpdate(LayoutActor* layout, const char* listName) {
     if (!layout->getExecuteInfo())
         layout->initExecuteInfo(new LayoutExecuteInfo());
 
-    for (s32 i = 0; i < mUpdateTableCount; i++)
-        mUpdateTables[i]->tryRegisterLayout(layout, listName);
+    for (u64 mask = sListNameMap->findUpdateTableMask(listName); mask != 0; mask &= mask - 1)
+        mUpdateTables[__builtin_ctzll(mask)]->tryRegisterLayout(layout, listName);
 }
 
 void ExecuteDirector::registerLayoutDraw(LayoutActor* layout, const char* listName) {
     if (!layout->getExecuteInfo())
         layout->initExecuteInfo(new LayoutExecuteInfo());
 
-    for (s32 i = 0; i < mDrawTableCount; i++)
-        mDrawTables[i]->tryRegisterLayout(layout, listName);
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1)
+        mDrawTables[__builtin_ctzll(mask)]->tryRegisterLayout(layout, listName);
 }
 
 void ExecuteDirector::registerUser(IUseExecutor* user, const char* listName) {
-    for (s32 i = 0; i < mUpdateTableCount; i++)
-        mUpdateTables[i]->tryRegisterUser(user, listName);
+    for (u64 mask = sListNameMap->findUpdateTableMask(listName); mask != 0; mask &= mask - 1)
+        mUpdateTables[__builtin_ctzll(mask)]->tryRegisterUser(user, listName);
 
-    for (s32 i = 0; i < mDrawTableCount; i++)
-        mDrawTables[i]->tryRegisterUser(user, listName);
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1)
+        mDrawTables[__builtin_ctzll(mask)]->tryRegisterUser(user, listName);
 }
 
 void ExecuteDirector::registerFunctor(const FunctorBase& functor, const char* listName) {
-    for (s32 i = 0; i < mUpdateTableCount; i++)
-        mUpdateTables[i]->tryRegisterFunctor(functor, listName);
+    for (u64 mask = sListNameMap->findUpdateTableMask(listName); mask != 0; mask &= mask - 1)
+        mUpdateTables[__builtin_ctzll(mask)]->tryRegisterFunctor(functor, listName);
 
-    for (s32 i = 0; i < mDrawTableCount; i++)
-        mDrawTables[i]->tryRegisterFunctor(functor, listName);
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1)
+        mDrawTables[__builtin_ctzll(mask)]->tryRegisterFunctor(functor, listName);
 }
 
 void ExecuteDirector::registerFunctorDraw(const FunctorBase& functor, const char* listName) {
-    for (s32 i = 0; i < mDrawTableCount; i++)
-        mDrawTables[i]->tryRegisterFunctor(functor, listName);
+    for (u64 mask = sListNameMap->findDrawTableMask(listName); mask != 0; mask &= mask - 1)
+        mDrawTables[__builtin_ctzll(mask)]->tryRegisterFunctor(functor, listName);
 }
 
 void ExecuteDirector::createExecutorListTable() {
@@ -114,85 +151,57 @@ void ExecuteDirector::createExecutorListTable() {
 }
 
 void ExecuteDirector::execute(const char* tableName) const {
-    if (!tableName) {
-        mRequestKeeper->executeRequestActorMovementAllOn();
-        mRequestKeeper->executeRequestActorDrawAllOn();
-
-        mUpdateTables[0]->execute();
+    executeTable(tableName ? findUpdateTableIndex(tableName) : 0);
+}
 
-        mRequestKeeper->executeRequestActorMovementAllOff();
-        mRequestKeeper->executeRequestActorDrawAllOff();
+// Actor requests are only applied around the main update table.
+void ExecuteDirector::executeTable(s32 tableIndex) const {
+    if (tableIndex < 0)
+        return;
 
+    if (tableIndex != 0) {
+        mUpdateTables[tableIndex]->execute();
         return;
     }
 
-    bool isActorEnabled = false;
-
-    if (isEqualString(tableName, mUpdateTables[0]->getName())) {
-        mRequestKeeper->executeRequestActorMovementAllOn();
-        mRequestKeeper->executeRequestActorDrawAllOn();
-        isActorEnabled = true;
-    }
+    AL_NERVE_TRACE_NEXT_FRAME();
+    mRequestKeeper->executeRequestActorMovementAllOn();
+    mRequestKeeper->executeRequestActorDrawAllOn();
 
-    for (s32 i = 0; i < mUpdateTableCount; i++) {
-        if (isEqualString(tableName, mUpdateTables[i]->getName())) {
-            mUpdateTables[i]->execute();
-            break;
-        }
-    }
+    mUpdateTables[0]->execute();
 
-    if (isActorEnabled) {
-        mRequestKeeper->executeRequestActorMovementAllOff();
-        mRequestKeeper->executeRequestActorDrawAllOff();
-    }
+    mRequestKeeper->executeRequestActorMovementAllOff();
+    mRequestKeeper->executeRequestActorDrawAllOff();
 }
 
 void ExecuteDirector::executeList(const char* tableName, const char* listName) const {
     mRequestKeeper->executeRequestActorMovementAllOn();
     mRequestKeeper->executeRequestActorDrawAllOn();
-    if (tableName) {
-        for (s32 i = 0; i < mUpdateTableCount; ++i)
-            if (isEqualString(tableName, mUpdateTables[i]->getName()))
-                mUpdateTables[i]->executeList(listName);
-    } else {
-        mUpdateTables[0]->executeList(listName);
-    }
+    s32 table_index = tableName ? findUpdateTableIndex(tableName) : 0;
+    if (table_index >= 0)
+        mUpdateTables[table_index]->executeList(listName);
     mRequestKeeper->executeRequestActorMovementAllOff();
     mRequestKeeper->executeRequestActorDrawAllOff();
 }
 
 void ExecuteDirector::draw(const char* tableName) const {
-    if (!tableName) {
-        mDrawTables[0]->execute();
-        return;
-    }
+    drawTable(tableName ? findDrawTableIndex(tableName) : 0);
+}
 
-    for (s32 i = 0; i < mDrawTableCount; ++i) {
-        if (isEqualString(tableName, mDrawTables[i]->getName())) {
-            mDrawTables[i]->execute();
-            return;
-        }
-    }
+void ExecuteDirector::drawTable(s32 tableIndex) const {
+    if (tableIndex >= 0)
+        mDrawTables[tableIndex]->execute();
 }
 
 void ExecuteDirector::drawList(const char* tableName, const char* listName) const {
-    for (s32 i = 0; i < mDrawTableCount; ++i) {
-        if (isEqualString(tableName, mDrawTables[i]->getName())) {
-            mDrawTables[i]->executeList(listName);
-            return;
-        }
-    }
+    s32 table_index = findDrawTableIndex(tableName);
+    if (table_index >= 0)
+        mDrawTables[table_index]->executeList(listName);
 }
 
 bool ExecuteDirector::isActiveDraw(const char* tableName) const {
-    if (!tableName)
-        return mDrawTables[0]->isActive();
-
-    for (s32 i = 0; i < mDrawTableCount; ++i)
-        if (isEqualString(tableName, mDrawTables[i]->getName()))
-            return mDrawTables[i]->isActive();
-
-    return false;
+    s32 table_index = tableName ? findDrawTableIndex(tableName) : 0;
+    return table_index >= 0 && mDrawTables[table_index]->isActive();
 }
 
 }  // namespace al
@@ -5,6 +5,7 @@
 #include "Library/HostIO/HioNode.h"
 
 namespace al {
+class ExecuteNameMap;
 class ExecuteRequestKeeper;
 class ExecuteTableHolderDraw;
 class ExecuteTableHolderUpdate;
@@ -34,6 +35,13 @@ public:
     void drawList(const char* tableName, const char* listName) const;
     bool isActiveDraw(const char* tableName) const;
 
+    // Table names resolved once, for callers that run the same table every frame. -1 if there is
+    // no table with the name, which executeTable and drawTable ignore.
+    s32 findUpdateTableIndex(const char* tableName) const;
+    s32 findDrawTableIndex(const char* tableName) const;
+    void executeTable(s32 tableIndex) const;
+    void drawTable(s32 tableIndex) const;
+
 private:
     s32 mRequestCount;
     s32 mUpdateTableCount = 0;
@@ -41,6 +49,11 @@ private:
     s32 mDrawTableCount = 0;
     ExecuteTableHolderDraw** mDrawTables = nullptr;
     ExecuteRequestKeeper* mRequestKeeper = nullptr;
+
+    // Built from the static tables, so every director shares them. Static so that the director
+    // keeps its layout.
+    static ExecuteNameMap* sTableNameMap;
+    static ExecuteNameMap* sListNameMap;
 };
 
 static_assert(sizeof(ExecuteDirector) == 0x30);
@@ -0,0 +1,65 @@
+#include "Library/Execute/ExecuteNameMap.h"
+
+#include "Library/Base/HashCodeUtil.h"
+#include "Library/Base/StringUtil.h"
+
+namespace al {
+
+ExecuteNameMap::ExecuteNameMap(s32 nameNumMax) {
+    mCapacity = 1;
+    while (mCapacity < nameNumMax * 2)
+        mCapacity *= 2;
+
+    mEntries = new Entry[mCapacity];
+    for (s32 i = 0; i < mCapacity; i++)
+        mEntries[i] = {nullptr, 0, 0, 0};
+}
+
+ExecuteNameMap::~ExecuteNameMap() {
+    delete[] mEntries;
+}
+
+ExecuteNameMap::Entry* ExecuteNameMap::tryFindEntry(const char* name, s32 hash) const {
+    u32 mask = mCapacity - 1;
+    for (u32 i = hash & mask; mEntries[i].name; i = (i + 1) & mask)
+        if (mEntries[i].hash == hash &&
+            (mEntries[i].name == name || isEqualString(mEntries[i].name, name)))
+            return &mEntries[i];
+    return nullptr;
+}
+
+// The capacity is twice the most names the tables can have, so the probe always finds a free slot.
+ExecuteNameMap::Entry* ExecuteNameMap::findOrAddEntry(const char* name) {
+    s32 hash = calcHashCode(name);
+    Entry* entry = tryFindEntry(name, hash);
+    if (entry)
+        return entry;
+
+    u32 mask = mCapacity - 1;
+    u32 i = hash & mask;
+    while (mEntries[i].name)
+        i = (i + 1) & mask;
+
+    mEntries[i] = {name, hash, 0, 0};
+    return &mEntries[i];
+}
+
+void ExecuteNameMap::addUpdateTable(const char* name, s32 tableIndex) {
+    findOrAddEntry(name)->updateTableMask |= 1ull << tableIndex;
+}
+
+void ExecuteNameMap::addDrawTable(const char* name, s32 tableIndex) {
+    findOrAddEntry(name)->drawTableMask |= 1ull << tableIndex;
+}
+
+u64 ExecuteNameMap::findUpdateTableMask(const char* name) const {
+    const Entry* entry = tryFindEntry(name, calcHashCode(name));
+    return entry ? entry->updateTableMask : 0;
+}
+
+u64 ExecuteNameMap::findDrawTableMask(const char* name) const {
+    const Entry* entry = tryFindEntry(name, calcHashCode(name));
+    return entry ? entry->drawTableMask : 0;
+}
+
+}  // namespace al
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+namespace al {
+
+// Maps table or list names to the update and draw tables that have them, as one bit per table
+// index. Built once when the tables are created, and only read afterwards.
+class ExecuteNameMap {
+public:
+    ExecuteNameMap(s32 nameNumMax);
+    ~ExecuteNameMap();
+
+    void addUpdateTable(const char* name, s32 tableIndex);
+    void addDrawTable(const char* name, s32 tableIndex);
+    u64 findUpdateTableMask(const char* name) const;
+    u64 findDrawTableMask(const char* name) const;
+
+private:
+    struct Entry {
+        const char* name;
+        s32 hash;
+        u64 updateTableMask;
+        u64 drawTableMask;
+    };
+
+    Entry* tryFindEntry(const char* name, s32 hash) const;
+    Entry* findOrAddEntry(const char* name);
+
+    Entry* mEntries = nullptr;
+    s32 mCapacity = 0;
+};
+
+}  // namespace al
@@ -0,0 +1,128 @@
+#include "Library/Execute/ExecuteProfiler.h"
+
+#ifdef AL_EXECUTE_PROFILE
+
+#include <cstdio>
+#include <nn/os.h>
+
+namespace al {
+namespace {
+f64 convertTickToMicroSeconds(s64 tick) {
+    return (f64)tick * 1000000.0 / (f64)nn::os::GetSystemTickFrequency();
+}
+}  // namespace
+
+ExecuteProfiler::Event ExecuteProfiler::sEvents[cEventNum];
+std::atomic<u32> ExecuteProfiler::sWriteIndex{0};
+bool ExecuteProfiler::sIsEnable = false;
+s32 ExecuteProfiler::sActorOutlierMicroSeconds = 500;
+s64 ExecuteProfiler::sActorOutlierTick = 0;
+
+void ExecuteProfiler::setEnable(bool isEnable) {
+    sActorOutlierTick = nn::os::GetSystemTickFrequency() * sActorOutlierMicroSeconds / 1000000;
+    sIsEnable = isEnable;
+}
+
+bool ExecuteProfiler::isEnable() {
+    return sIsEnable;
+}
+
+void ExecuteProfiler::setActorOutlierMicroSeconds(s32 microSeconds) {
+    sActorOutlierMicroSeconds = microSeconds;
+    sActorOutlierTick = nn::os::GetSystemTickFrequency() * microSeconds / 1000000;
+}
+
+void ExecuteProfiler::clear() {
+    for (s32 i = 0; i < cEventNum; i++)
+        sEvents[i].sequence.store(0, std::memory_order_relaxed);
+    sWriteIndex.store(0);
+}
+
+s64 ExecuteProfiler::getTick() {
+    return nn::os::GetSystemTick().GetInt64Value();
+}
+
+bool ExecuteProfiler::isActorOutlier(s64 beginTick, s64 endTick) {
+    return endTick - beginTick >= sActorOutlierTick;
+}
+
+// Any thread may record at once. Every event takes the next slot of the ring, and its sequence is
+// published after the event is written, so the reader can tell written slots from stale ones.
+void ExecuteProfiler::record(ExecuteProfileEventType type, const char* name, const void* actor,
+                             s64 beginTick, s64 endTick, s32 count) {
+    u32 index = sWriteIndex.fetch_add(1, std::memory_order_relaxed);
+    Event& event = sEvents[index % cEventNum];
+    event.sequence.store(0, std::memory_order_relaxed);
+    event.type = type;
+    event.coreNumber = nn::os::GetCurrentCoreNumber();
+    event.count = count;
+    event.name = name;
+    event.actor = actor;
+    event.beginTick = beginTick;
+    event.endTick = endTick;
+    event.sequence.store(index + 1, std::memory_order_release);
+}
+
+// Writes the events still in the ring, oldest first, and stops at the last event that fits.
+// Returns the length of the JSON, which is always closed.
+s32 ExecuteProfiler::writeChromeTrace(char* buffer, s32 bufferSize) {
+    static const char cHeader[] = "{\"traceEvents\":[";
+    static const char cFooter[] = "\n]}\n";
+    if (bufferSize < (s32)(sizeof(cHeader) + sizeof(cFooter)))
+        return 0;
+
+    s32 size = snprintf(buffer, bufferSize, "%s", cHeader);
+    s32 size_max = bufferSize - sizeof(cFooter);
+    u32 write_index = sWriteIndex.load(std::memory_order_acquire);
+    u32 begin = write_index > cEventNum ? write_index - cEventNum : 0;
+    bool is_first = true;
+    for (u32 index = begin; index < write_index; index++) {
+        const Event& event = sEvents[index % cEventNum];
+        if (event.sequence.load(std::memory_order_acquire) != index + 1)
+            continue;
+
+        const char* separator = is_first ? "\n" : ",\n";
+        f64 ts = convertTickToMicroSeconds(event.beginTick);
+        f64 dur = convertTickToMicroSeconds(event.endTick - event.beginTick);
+        s32 rest = size_max - size;
+        s32 length = 0;
+        switch (event.type) {
+        case ExecuteProfileEventType::Table:
+        case ExecuteProfileEventType::List:
+            length = snprintf(buffer + size, rest,
+                              "%s{\"name\":\"%s\",\"cat\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+                              "\"dur\":%.3f,\"pid\":0,\"tid\":%d}",
+                              separator, event.name,
+                              event.type == ExecuteProfileEventType::Table ? "table" : "list", ts,
+                              dur, event.coreNumber);
+            break;
+        case ExecuteProfileEventType::ActorNum:
+            length = snprintf(buffer + size, rest,
+                              "%s{\"name\":\"%s\",\"cat\":\"actorNum\",\"ph\":\"C\",\"ts\":%.3f,"
+                              "\"pid\":0,\"tid\":%d,\"args\":{\"actorNum\":%d}}",
+                              separator, event.name, ts, event.coreNumber, event.count);
+            break;
+        case ExecuteProfileEventType::Actor:
+            length = snprintf(buffer + size, rest,
+                              "%s{\"name\":\"%s\",\"cat\":\"actor\",\"ph\":\"X\",\"ts\":%.3f,"
+                              "\"dur\":%.3f,\"pid\":0,\"tid\":%d,\"args\":{\"actor\":\"%p\"}}",
+                              separator, event.name, ts, dur, event.coreNumber, event.actor);
+            break;
+        }
+
+        if (length >= rest)
+            break;
+        // events overwritten while they were written are left out as well
+        if (event.sequence.load(std::memory_order_acquire) != index + 1)
+            continue;
+        size += length;
+        is_first = false;
+    }
+
+    size += snprintf(buffer + size, bufferSize - size, "%s", cFooter);
+    return size;
+}
+
+}  // namespace al
+
+#endif
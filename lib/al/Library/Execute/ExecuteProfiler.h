@@ -0,0 +1,99 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#ifdef AL_EXECUTE_PROFILE
+#include <atomic>
+#endif
+
+namespace al {
+
+// Records the time every executor table and list takes, the actor count of the actor lists and
+// the actors that take longer than the outlier threshold, into a ring buffer of the last events.
+// writeChromeTrace turns the buffer into a Chrome trace_event JSON. Builds without
+// AL_EXECUTE_PROFILE compile every recording out.
+#ifdef AL_EXECUTE_PROFILE
+enum class ExecuteProfileEventType : u8 { Table, List, ActorNum, Actor };
+
+class ExecuteProfiler {
+public:
+    static constexpr s32 cEventNum = 16384;
+
+    static void setEnable(bool isEnable);
+    static bool isEnable();
+    static void setActorOutlierMicroSeconds(s32 microSeconds);
+    static void clear();
+    static s64 getTick();
+    static void record(ExecuteProfileEventType type, const char* name, const void* actor,
+                       s64 beginTick, s64 endTick, s32 count);
+    static bool isActorOutlier(s64 beginTick, s64 endTick);
+    // Call between frames, events recorded while writing are left out.
+    static s32 writeChromeTrace(char* buffer, s32 bufferSize);
+
+private:
+    struct Event {
+        std::atomic<u32> sequence;
+        ExecuteProfileEventType type;
+        s8 coreNumber;
+        s32 count;
+        const char* name;
+        const void* actor;
+        s64 beginTick;
+        s64 endTick;
+    };
+
+    static Event sEvents[cEventNum];
+    static std::atomic<u32> sWriteIndex;
+    static bool sIsEnable;
+    static s32 sActorOutlierMicroSeconds;
+    static s64 sActorOutlierTick;
+};
+
+class ExecuteProfileScope {
+public:
+    ExecuteProfileScope(ExecuteProfileEventType type, const char* name,
+                        const void* actor = nullptr)
+        : mType(type), mName(name), mActor(actor),
+          mBeginTick(ExecuteProfiler::isEnable() ? ExecuteProfiler::getTick() : -1) {}
+
+    ~ExecuteProfileScope() {
+        if (mBeginTick < 0)
+            return;
+
+        s64 end_tick = ExecuteProfiler::getTick();
+        if (mType == ExecuteProfileEventType::Actor &&
+            !ExecuteProfiler::isActorOutlier(mBeginTick, end_tick))
+            return;
+        ExecuteProfiler::record(mType, mName, mActor, mBeginTick, end_tick, 0);
+    }
+
+private:
+    ExecuteProfileEventType mType;
+    const char* mName;
+    const void* mActor;
+    s64 mBeginTick;
+};
+
+#define AL_EXECUTE_PROFILE_TABLE(name)                                                             \
+    al::ExecuteProfileScope executeProfileTableScope(al::ExecuteProfileEventType::Table, name)
+#define AL_EXECUTE_PROFILE_LIST(name)                                                              \
+    al::ExecuteProfileScope executeProfileListScope(al::ExecuteProfileEventType::List, name)
+#define AL_EXECUTE_PROFILE_ACTOR(name, actor)                                                      \
+    al::ExecuteProfileScope executeProfileActorScope(al::ExecuteProfileEventType::Actor, name,    \
+                                                     actor)
+#define AL_EXECUTE_PROFILE_ACTOR_NUM(name, actorNum)                                               \
+    do {                                                                                           \
+        if (al::ExecuteProfiler::isEnable()) {                                                     \
+            s64 tick = al::ExecuteProfiler::getTick();                                             \
+            al::ExecuteProfiler::record(al::ExecuteProfileEventType::ActorNum, name, nullptr,      \
+                                        tick, tick, actorNum);                                     \
+        }                                                                                          \
+    } while (0)
+#else
+#define AL_EXECUTE_PROFILE_TABLE(name)
+#define AL_EXECUTE_PROFILE_LIST(name)
+#define AL_EXECUTE_PROFILE_ACTOR(name, actor)
+#define AL_EXECUTE_PROFILE_ACTOR_NUM(name, actorNum)
+#endif
+
+}  // namespace al
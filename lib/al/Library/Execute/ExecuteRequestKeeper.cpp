@@ -0,0 +1,249 @@
+#include "Library/Execute/ExecuteRequestKeeper.h"
+
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+
+#include "Library/Execute/ActorExecuteInfo.h"
+#include "Library/Execute/ExecuteTableHolderUpdate.h"
+#include "Library/LiveActor/LiveActor.h"
+
+namespace al {
+namespace {
+u32 calcTableCapacity(s32 maxSize) {
+    u32 capacity = 1;
+    while (capacity < (u32)maxSize)
+        capacity *= 2;
+    return capacity;
+}
+
+// request IDs wrap around, so they are compared by their distance
+bool isNewerRequest(u32 requestId, u32 otherRequestId) {
+    return (s32)(requestId - otherRequestId) > 0;
+}
+}  // namespace
+
+ExecuteRequestInfo::ExecuteRequestInfo() : _0(0) {}
+
+// A bounded queue where every entry has a sequence, which tells a pushing thread whether the entry
+// is free and the popping thread whether it has been written.
+ExecuteRequestTable::ExecuteRequestTable(s32 maxSize) {
+    u32 capacity = calcTableCapacity(maxSize);
+    mMask = capacity - 1;
+    mEntries = new Entry[capacity];
+    for (u32 i = 0; i < capacity; i++) {
+        mEntries[i].sequence.store(i, std::memory_order_relaxed);
+        mEntries[i].requestId = 0;
+        mEntries[i].actor = nullptr;
+    }
+}
+
+// Fails if the table is full.
+bool ExecuteRequestTable::tryPush(LiveActor* actor, u32 requestId) {
+    u32 tail = mTail.load(std::memory_order_relaxed);
+    while (true) {
+        Entry& entry = mEntries[tail & mMask];
+        s32 distance = (s32)(entry.sequence.load(std::memory_order_acquire) - tail);
+        if (distance < 0)
+            return false;
+        if (distance > 0) {
+            tail = mTail.load(std::memory_order_relaxed);
+            continue;
+        }
+        if (mTail.compare_exchange_weak(tail, tail + 1, std::memory_order_relaxed)) {
+            entry.requestId = requestId;
+            entry.actor = actor;
+            entry.sequence.store(tail + 1, std::memory_order_release);
+            return true;
+        }
+    }
+}
+
+// Counts the written entries in front of the first one that is still being pushed.
+s32 ExecuteRequestTable::calcPendingNum() const {
+    s32 num = 0;
+    while (num <= (s32)mMask &&
+           mEntries[(mHead + num) & mMask].sequence.load(std::memory_order_acquire) ==
+               mHead + num + 1)
+        num++;
+    return num;
+}
+
+void ExecuteRequestTable::cancelPending(s32 index) {
+    mEntries[(mHead + index) & mMask].actor = nullptr;
+}
+
+void ExecuteRequestTable::pop(s32 num) {
+    for (s32 i = 0; i < num; i++) {
+        Entry& entry = mEntries[mHead & mMask];
+        entry.actor = nullptr;
+        entry.sequence.store(mHead + mMask + 1, std::memory_order_release);
+        mHead++;
+    }
+}
+
+ExecuteRequestKeeper::ExecuteRequestKeeper(s32 maxSize) {
+    mMovementOn = new ExecuteRequestTable(maxSize);
+    mMovementOff = new ExecuteRequestTable(maxSize);
+    mDrawOn = new ExecuteRequestTable(maxSize);
+    mDrawOff = new ExecuteRequestTable(maxSize);
+
+    u32 capacity = calcTableCapacity(maxSize) * 2;
+    mActorRequestMask = capacity - 1;
+    mActorRequests = new ActorRequest[capacity];
+    for (u32 i = 0; i < capacity; i++)
+        mActorRequests[i] = {nullptr, 0, 0, 0, false};
+}
+
+void ExecuteRequestKeeper::executeRequestActorMovementAllOn() {
+    executeRequest(mMovementOn, mMovementOff, alActorSystemFunction::addToExecutorMovement);
+}
+
+void ExecuteRequestKeeper::executeRequestActorMovementAllOff() {
+    executeRequest(mMovementOff, mMovementOn, alActorSystemFunction::removeFromExecutorMovement);
+}
+
+void ExecuteRequestKeeper::executeRequestActorDrawAllOn() {
+    executeRequest(mDrawOn, mDrawOff, alActorSystemFunction::addToExecutorDraw);
+}
+
+void ExecuteRequestKeeper::executeRequestActorDrawAllOff() {
+    executeRequest(mDrawOff, mDrawOn, alActorSystemFunction::removeFromExecutorDraw);
+}
+
+// Any thread may request. Each table holds as many requests as the director has actors, and
+// requests that do not fit are dropped.
+void ExecuteRequestKeeper::request(LiveActor* actor, Request requestType) {
+    u32 request_id = mNextRequestId.fetch_add(1, std::memory_order_relaxed);
+    switch (requestType) {
+    case Request_Movement:
+        mMovementOn->tryPush(actor, request_id);
+        break;
+    case Request_RemoveFromMovement:
+        mMovementOff->tryPush(actor, request_id);
+        break;
+    case Request_Draw:
+        mDrawOn->tryPush(actor, request_id);
+        break;
+    case Request_RemoveFromDraw:
+        mDrawOff->tryPush(actor, request_id);
+        break;
+    }
+}
+
+// Executes the requests of the table, except the ones an actor made before the opposite request.
+// Opposite requests made before a request of the table are cancelled, so whichever of the two an
+// actor made last wins, however the requests are executed.
+void ExecuteRequestKeeper::executeRequest(ExecuteRequestTable* table,
+                                          ExecuteRequestTable* oppositeTable,
+                                          void (*executeFunc)(LiveActor*)) {
+    s32 num = table->calcPendingNum();
+    if (num == 0)
+        return;
+
+    s32 opposite_num = oppositeTable->calcPendingNum();
+    if (opposite_num == 0) {
+        for (s32 i = 0; i < num; i++)
+            if (LiveActor* actor = table->getPendingActor(i))
+                executeFunc(actor);
+        table->pop(num);
+        return;
+    }
+
+    mGeneration++;
+    for (s32 i = 0; i < num; i++) {
+        const LiveActor* actor = table->getPendingActor(i);
+        if (!actor)
+            continue;
+        u32 request_id = table->getPendingRequestId(i);
+        ActorRequest* actor_request = findOrAddActorRequest(actor, request_id);
+        if (isNewerRequest(request_id, actor_request->requestId))
+            actor_request->requestId = request_id;
+    }
+
+    for (s32 i = 0; i < opposite_num; i++) {
+        const LiveActor* actor = oppositeTable->getPendingActor(i);
+        if (!actor)
+            continue;
+        ActorRequest* actor_request = findActorRequest(actor);
+        if (!actor_request)
+            continue;
+
+        u32 request_id = oppositeTable->getPendingRequestId(i);
+        if (isNewerRequest(actor_request->requestId, request_id)) {
+            oppositeTable->cancelPending(i);
+        } else if (!actor_request->isOppositeRequested ||
+                   isNewerRequest(request_id, actor_request->oppositeRequestId)) {
+            actor_request->oppositeRequestId = request_id;
+            actor_request->isOppositeRequested = true;
+        }
+    }
+
+    for (s32 i = 0; i < num; i++) {
+        LiveActor* actor = table->getPendingActor(i);
+        if (!actor)
+            continue;
+        const ActorRequest* actor_request = findActorRequest(actor);
+        if (actor_request->isOppositeRequested &&
+            isNewerRequest(actor_request->oppositeRequestId, table->getPendingRequestId(i)))
+            continue;
+        executeFunc(actor);
+    }
+    table->pop(num);
+}
+
+// The lookup is a hash table at most half full, whose entries from earlier executions are told
+// apart by the generation.
+ExecuteRequestKeeper::ActorRequest*
+ExecuteRequestKeeper::findActorRequest(const LiveActor* actor) {
+    u64 key = reinterpret_cast<uintptr_t>(actor);
+    u32 hash = static_cast<u32>((key >> 4) ^ (key >> 32)) * 0x9e3779b1u;
+    for (u32 slot = hash & mActorRequestMask;; slot = (slot + 1) & mActorRequestMask) {
+        ActorRequest* actor_request = &mActorRequests[slot];
+        if (actor_request->generation != mGeneration)
+            return nullptr;
+        if (actor_request->actor == actor)
+            return actor_request;
+    }
+}
+
+ExecuteRequestKeeper::ActorRequest*
+ExecuteRequestKeeper::findOrAddActorRequest(const LiveActor* actor, u32 requestId) {
+    u64 key = reinterpret_cast<uintptr_t>(actor);
+    u32 hash = static_cast<u32>((key >> 4) ^ (key >> 32)) * 0x9e3779b1u;
+    for (u32 slot = hash & mActorRequestMask;; slot = (slot + 1) & mActorRequestMask) {
+        ActorRequest* actor_request = &mActorRequests[slot];
+        if (actor_request->generation != mGeneration) {
+            *actor_request = {actor, mGeneration, requestId, 0, false};
+            return actor_request;
+        }
+        if (actor_request->actor == actor)
+            return actor_request;
+    }
+}
+
+}  // namespace al
+
+namespace alActorSystemFunction {
+
+void requestAddToExecutorMovement(al::LiveActor* actor) {
+    actor->getExecuteInfo()->getRequestKeeper()->request(
+        actor, al::ExecuteRequestKeeper::Request_Movement);
+}
+
+void requestAddToExecutorDraw(al::LiveActor* actor) {
+    actor->getExecuteInfo()->getRequestKeeper()->request(actor,
+                                                         al::ExecuteRequestKeeper::Request_Draw);
+}
+
+void requestRemoveFromExecutorMovement(al::LiveActor* actor) {
+    actor->getExecuteInfo()->getRequestKeeper()->request(
+        actor, al::ExecuteRequestKeeper::Request_RemoveFromMovement);
+}
+
+void requestRemoveFromExecutorDraw(al::LiveActor* actor) {
+    actor->getExecuteInfo()->getRequestKeeper()->request(
+        actor, al::ExecuteRequestKeeper::Request_RemoveFromDraw);
+}
+
+}  // namespace alActorSystemFunction
+
+#endif
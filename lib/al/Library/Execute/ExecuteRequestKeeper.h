@@ -1,5 +1,8 @@
 #pragma once
 
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+#include <atomic>
+#endif
 #include <basis/seadTypes.h>
 
 namespace al {
@@ -15,6 +18,38 @@ private:
 
 static_assert(sizeof(ExecuteRequestInfo) == 0x8);
 
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+// Requests of one kind in the order they were made. Any thread may push, only the thread that
+// executes the requests reads and pops them.
+// NON_MATCHING: the original table is a count, a maximum size and an array of actors (0x10)
+class ExecuteRequestTable {
+public:
+    ExecuteRequestTable(s32 maxSize);
+
+    bool tryPush(LiveActor* actor, u32 requestId);
+    s32 calcPendingNum() const;
+    LiveActor* getPendingActor(s32 index) const { return getPendingEntry(index).actor; }
+    u32 getPendingRequestId(s32 index) const { return getPendingEntry(index).requestId; }
+    void cancelPending(s32 index);
+    void pop(s32 num);
+
+private:
+    struct Entry {
+        std::atomic<u32> sequence;
+        u32 requestId;
+        LiveActor* actor;
+    };
+
+    const Entry& getPendingEntry(s32 index) const { return mEntries[(mHead + index) & mMask]; }
+
+    std::atomic<u32> mTail{0};
+    u32 mHead = 0;
+    u32 mMask;
+    Entry* mEntries;
+};
+
+static_assert(sizeof(ExecuteRequestTable) == 0x18);
+#else
 class ExecuteRequestTable {
 public:
     ExecuteRequestTable(s32 maxSize);
@@ -26,7 +61,12 @@ private:
 };
 
 static_assert(sizeof(ExecuteRequestTable) == 0x10);
+#endif
 
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+// NON_MATCHING: the original keeper holds only the four tables (0x20), the request IDs and the
+// lookup of the requests of each actor are added
+#endif
 class ExecuteRequestKeeper {
 public:
     enum Request : s32 {
@@ -45,12 +85,37 @@ public:
     void request(LiveActor* actor, Request requestType);
 
 private:
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+    struct ActorRequest {
+        const LiveActor* actor;
+        u32 generation;
+        u32 requestId;
+        u32 oppositeRequestId;
+        bool isOppositeRequested;
+    };
+
+    void executeRequest(ExecuteRequestTable* table, ExecuteRequestTable* oppositeTable,
+                        void (*executeFunc)(LiveActor*));
+    ActorRequest* findActorRequest(const LiveActor* actor);
+    ActorRequest* findOrAddActorRequest(const LiveActor* actor, u32 requestId);
+#endif
+
     ExecuteRequestTable* mMovementOn;
     ExecuteRequestTable* mMovementOff;
     ExecuteRequestTable* mDrawOn;
     ExecuteRequestTable* mDrawOff;
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+    std::atomic<u32> mNextRequestId{0};
+    ActorRequest* mActorRequests;
+    u32 mActorRequestMask;
+    u32 mGeneration = 0;
+#endif
 };
 
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+static_assert(sizeof(ExecuteRequestKeeper) == 0x38);
+#else
 static_assert(sizeof(ExecuteRequestKeeper) == 0x20);
+#endif
 
 }  // namespace al
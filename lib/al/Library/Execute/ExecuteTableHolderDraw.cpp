@@ -0,0 +1,23 @@
+#include "Library/Execute/ExecuteTableHolderDraw.h"
+
+#ifdef AL_EXECUTE_PROFILE
+
+#include "Library/Execute/ExecuteProfiler.h"
+#include "Library/Execute/ExecutorListBase.h"
+
+namespace al {
+
+// NON_MATCHING: the original body is not known, this runs the active lists in order with the
+// profiler scopes around the table and every list. Left undefined without AL_EXECUTE_PROFILE
+void ExecuteTableHolderDraw::execute() const {
+    AL_EXECUTE_PROFILE_TABLE(mName);
+    for (s32 i = 0; i < mActiveExecutors.size(); i++) {
+        const ExecutorListBase* list = mActiveExecutors.at(i);
+        AL_EXECUTE_PROFILE_LIST(list->getName());
+        list->executeList();
+    }
+}
+
+}  // namespace al
+
+#endif
@@ -59,4 +59,14 @@ void addToExecutorDraw(al::LiveActor* actor);
 void removeFromExecutorMovement(al::LiveActor* actor);
 void removeFromExecutorDraw(al::LiveActor* actor);
 void updateExecutorDraw(al::LiveActor* actor);
+
+#ifdef AL_EXECUTE_REQUEST_QUEUE
+// Can be called from any thread. The requests are applied through the functions above by the
+// ExecuteRequestKeeper of the actor, when the main update table executes next. Nothing in the
+// library calls them yet, they are for actor code that runs off the main thread.
+void requestAddToExecutorMovement(al::LiveActor* actor);
+void requestAddToExecutorDraw(al::LiveActor* actor);
+void requestRemoveFromExecutorMovement(al::LiveActor* actor);
+void requestRemoveFromExecutorDraw(al::LiveActor* actor);
+#endif
 }  // namespace alActorSystemFunction
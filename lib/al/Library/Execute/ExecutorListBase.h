@@ -10,6 +10,8 @@ public:
     virtual void executeList() const;
     virtual bool isActive() const;
 
+    const char* getName() const { return mName; }
+
 private:
     const char* mName;
 };
@@ -0,0 +1,107 @@
+#include "Library/HitSensor/SensorMsgQueue.h"
+
+#ifdef AL_SENSOR_MSG_DENSE_ID
+
+#include "Library/LiveActor/ActorSensorFunction.h"
+#include "Library/LiveActor/ActorSensorMsgFunction.h"
+#include "Library/LiveActor/LiveActor.h"
+
+namespace al {
+
+SensorMsgQueue* SensorMsgQueue::sActiveQueue = nullptr;
+
+// The receiver lookup is a hash table at most half full, so probing stays short.
+SensorMsgQueue::SensorMsgQueue(s32 maxMsgNum) : mMaxMsgNum(maxMsgNum) {
+    mMsgs = new Msg[maxMsgNum];
+    mBatches = new Batch[maxMsgNum];
+
+    s32 slot_num = 16;
+    while (slot_num < maxMsgNum * 2)
+        slot_num *= 2;
+    mSlotMask = slot_num - 1;
+    mSlots = new s32[slot_num];
+    for (s32 i = 0; i < slot_num; i++)
+        mSlots[i] = -1;
+
+    for (s32 i = 0; i <= cSensorMsgIdNum; i++)
+        mMsgNums[i] = 0;
+}
+
+void SensorMsgQueue::begin() {
+    for (s32 i = 0; i <= cSensorMsgIdNum; i++)
+        mMsgNums[i] = 0;
+    mOverflowMsgNum = 0;
+    sActiveQueue = this;
+}
+
+// Messages sent while the batches are delivered are not queued again but delivered right away.
+void SensorMsgQueue::end() {
+    if (sActiveQueue == this)
+        sActiveQueue = nullptr;
+    flush();
+}
+
+void SensorMsgQueue::send(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender) {
+    mMsgNums[static_cast<s32>(msgId)]++;
+    if (mMsgNum == mMaxMsgNum) {
+        mOverflowMsgNum++;
+        deliverSensorMsg(msgId, receiver, sender);
+        return;
+    }
+
+    s32 index = mMsgNum++;
+    Msg& msg = mMsgs[index];
+    msg.msgId = msgId;
+    msg.next = -1;
+    msg.receiver = receiver;
+    msg.sender = sender;
+
+    Batch& batch = mBatches[findOrAddBatch(getSensorHost(receiver))];
+    if (batch.head < 0)
+        batch.head = index;
+    else
+        mMsgs[batch.tail].next = index;
+    batch.tail = index;
+}
+
+void SensorMsgQueue::flush() {
+    for (s32 i = 0; i < mBatchNum; i++)
+        mSlots[mBatches[i].slot] = -1;
+
+    for (s32 i = 0; i < mBatchNum; i++)
+        for (s32 index = mBatches[i].head; index >= 0; index = mMsgs[index].next)
+            deliverSensorMsg(mMsgs[index].msgId, mMsgs[index].receiver, mMsgs[index].sender);
+    mMsgNum = 0;
+    mBatchNum = 0;
+}
+
+s32 SensorMsgQueue::findOrAddBatch(LiveActor* actor) {
+    u64 key = reinterpret_cast<uintptr_t>(actor);
+    u32 hash = static_cast<u32>((key >> 4) ^ (key >> 32)) * 0x9e3779b1u;
+    for (s32 slot = hash & mSlotMask;; slot = (slot + 1) & mSlotMask) {
+        s32 index = mSlots[slot];
+        if (index < 0) {
+            index = mBatchNum++;
+            mSlots[slot] = index;
+            mBatches[index].actor = actor;
+            mBatches[index].head = -1;
+            mBatches[index].tail = -1;
+            mBatches[index].slot = slot;
+            return index;
+        }
+        if (mBatches[index].actor == actor)
+            return index;
+    }
+}
+
+// Delivers a message without a payload right away. The isMsg tests of these messages only look
+// at the ID, so the base class can stand in for the message type. It goes straight to the host of
+// the receiver, without the checks the sendMsg functions may do first.
+void deliverSensorMsg(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender) {
+    SensorMsg msg(msgId);
+    getSensorHost(receiver)->receiveMsg(&msg, sender, receiver);
+}
+
+}  // namespace al
+
+#endif
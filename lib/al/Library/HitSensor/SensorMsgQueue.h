@@ -0,0 +1,76 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#include "Library/LiveActor/SensorMsgId.h"
+
+// Needs the message IDs, which are only there with AL_SENSOR_MSG_DENSE_ID.
+#ifdef AL_SENSOR_MSG_DENSE_ID
+
+namespace al {
+class HitSensor;
+class LiveActor;
+
+// Collects the messages whose result the sender does not need while it is active, and delivers
+// them in end(), grouped by the receiving actor. Every actor then handles all of its messages in
+// one go, instead of between the messages of unrelated actors. The order of the messages to one
+// actor is kept, and actors receive theirs in the order of their first message.
+//
+// Also counts how many messages of each type are sent through sendMsgDeferrable between begin()
+// and end(). Nothing begins a queue by itself, the owner of the sensor phase has to.
+class SensorMsgQueue {
+public:
+    SensorMsgQueue(s32 maxMsgNum);
+
+    void begin();
+    void end();
+    void send(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender);
+
+    static SensorMsgQueue* getActiveQueue() { return sActiveQueue; }
+
+    bool isActive() const { return sActiveQueue == this; }
+
+    s32 getMsgNum(SensorMsgId msgId) const { return mMsgNums[static_cast<s32>(msgId)]; }
+
+    // sent right away since the queue was full
+    s32 getOverflowMsgNum() const { return mOverflowMsgNum; }
+
+    s32 getReceiverNum() const { return mBatchNum; }
+
+private:
+    struct Msg {
+        SensorMsgId msgId;
+        s32 next;
+        HitSensor* receiver;
+        HitSensor* sender;
+    };
+
+    struct Batch {
+        LiveActor* actor;
+        s32 head;
+        s32 tail;
+        s32 slot;
+    };
+
+    void flush();
+    s32 findOrAddBatch(LiveActor* actor);
+
+    static SensorMsgQueue* sActiveQueue;
+
+    s32 mMaxMsgNum;
+    s32 mMsgNum = 0;
+    Msg* mMsgs;
+    s32 mBatchNum = 0;
+    Batch* mBatches;
+    s32 mSlotMask;
+    s32* mSlots;
+    s32 mOverflowMsgNum = 0;
+    s32 mMsgNums[cSensorMsgIdNum + 1];
+};
+
+// Only for the messages of SensorMsgCategory::cDeferrable, see sendMsgDeferrable.
+void deliverSensorMsg(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender);
+
+}  // namespace al
+
+#endif
@@ -0,0 +1,84 @@
+#include "Library/LiveActor/ActorSensorMsgFunction.h"
+
+#ifdef AL_SENSOR_MSG_DENSE_ID
+
+#include "Library/HitSensor/SensorMsgQueue.h"
+
+namespace al {
+
+bool sendMsgDeferrable(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender) {
+    if (msgId >= SensorMsgId::Invalid ||
+        !(cSensorMsgCategoryMasks[static_cast<s32>(msgId)] & SensorMsgCategory::cDeferrable))
+        return false;
+
+    SensorMsgQueue* queue = SensorMsgQueue::getActiveQueue();
+    if (queue)
+        queue->send(msgId, receiver, sender);
+    else
+        deliverSensorMsg(msgId, receiver, sender);
+    return true;
+}
+
+namespace {
+// Checks the precomputed categories of the message ID instead of testing every message of the
+// categories one after another. Messages without an ID are still tested one type at a time.
+bool isMsgCategory(const SensorMsg* msg, u32 categoryMask) {
+    if (msg->getMsgId() != SensorMsgId::Invalid)
+        return msg->isCategory(categoryMask);
+
+#define AL_SENSOR_MSG_TEST(Type, Categories)                                                       \
+    if (((Categories) & categoryMask) != 0 && isMsg##Type(msg))                                    \
+        return true;
+    AL_SENSOR_MSG_LIST(AL_SENSOR_MSG_TEST)
+#undef AL_SENSOR_MSG_TEST
+    return false;
+}
+}  // namespace
+
+bool isMsgPushAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cPushAll);
+}
+
+bool isMsgHoldReleaseAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cHoldReleaseAll);
+}
+
+bool isMsgItemGetDirectAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cItemGetDirectAll);
+}
+
+bool isMsgItemGetByObjAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cItemGetByObjAll);
+}
+
+bool isMsgItemGetAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cItemGetAll);
+}
+
+bool isMsgFloorTouch(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cFloorTouch);
+}
+
+bool isMsgUpperPunch(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cUpperPunch);
+}
+
+bool isMsgPlayerHipDropAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cPlayerHipDropAll);
+}
+
+bool isMsgPlayerObjHipDropAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cPlayerObjHipDropAll);
+}
+
+bool isMsgPlayerObjHipDropReflectAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cPlayerObjHipDropReflectAll);
+}
+
+bool isMsgTouchAssistAll(const SensorMsg* msg) {
+    return isMsgCategory(msg, SensorMsgCategory::cTouchAssistAll);
+}
+
+}  // namespace al
+
+#endif
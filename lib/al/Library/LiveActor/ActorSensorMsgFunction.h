@@ -3,8 +3,26 @@
 #include <math/seadVector.h>
 #include <prim/seadRuntimeTypeInfo.h>
 
+#ifdef AL_SENSOR_MSG_DENSE_ID
+#include "Library/LiveActor/SensorMsgId.h"
+#endif
+
 // TODO: This defines the class but the sead decomp doesn't have anything inside the RTTI functions,
 // causing the functions in the vtable to be exported
+#ifdef AL_SENSOR_MSG_DENSE_ID
+#define SENSOR_MSG(Type)                                                                           \
+    class SensorMsg##Type : public al::SensorMsg {                                                 \
+        SEAD_RTTI_OVERRIDE(SensorMsg##Type, al::SensorMsg)                                         \
+                                                                                                   \
+    public:                                                                                        \
+        SensorMsg##Type() : al::SensorMsg(al::SensorMsgId::Type) {}                                \
+    };                                                                                             \
+    bool isMsg##Type(const al::SensorMsg* msg) {                                                   \
+        if (msg->getMsgId() != al::SensorMsgId::Invalid)                                           \
+            return msg->getMsgId() == al::SensorMsgId::Type;                                       \
+        return SensorMsg##Type::checkDerivedRuntimeTypeInfoStatic(msg->getRuntimeTypeInfo());      \
+    }
+#else
 #define SENSOR_MSG(Type)                                                                           \
     class SensorMsg##Type : public al::SensorMsg {                                                 \
         SEAD_RTTI_OVERRIDE(SensorMsg##Type, al::SensorMsg)                                         \
@@ -12,12 +30,42 @@
     bool isMsg##Type(const al::SensorMsg* msg) {                                                   \
         return SensorMsg##Type::checkDerivedRuntimeTypeInfoStatic(msg->getRuntimeTypeInfo());      \
     }
+#endif
 
 namespace al {
 class SensorMsg {
     SEAD_RTTI_BASE(SensorMsg);
+
+#ifdef AL_SENSOR_MSG_DENSE_ID
+    // Messages carry their ID, so that tests and dispatch do not have to walk the RTTI. A message
+    // derived from another one keeps the ID of its base unless it passes its own. IDs outside of
+    // the list are stored as Invalid, and messages with an Invalid ID are tested through the RTTI.
+    // NON_MATCHING: the ID is not in the original class, which holds only the vtable (0x8). It
+    // moves the members of every derived message back by 8 bytes.
+public:
+    SensorMsg() = default;
+
+    SensorMsg(SensorMsgId msgId)
+        : mMsgId(msgId < SensorMsgId::Invalid ? msgId : SensorMsgId::Invalid) {}
+
+    SensorMsgId getMsgId() const { return mMsgId; }
+
+    // Always false for messages without an ID.
+    bool isCategory(u32 categoryMask) const {
+        return cSensorMsgCategoryMasks[static_cast<s32>(mMsgId)] & categoryMask;
+    }
+
+private:
+    SensorMsgId mMsgId = SensorMsgId::Invalid;
+#endif
 };
 
+#ifdef AL_SENSOR_MSG_DENSE_ID
+static_assert(sizeof(SensorMsg) == 0x10);
+#else
+static_assert(sizeof(SensorMsg) == 0x8);
+#endif
+
 class HitSensor;
 class ComboCounter;
 class LiveActor;
@@ -233,6 +281,14 @@ bool sendMsgStringV4fSensorPtr(HitSensor* receiver, HitSensor* sender, const cha
                                sead::Vector4f* vec);
 bool sendMsgStringVoidPtr(HitSensor* receiver, HitSensor* sender, const char* str, void* ptr);
 
+#ifdef AL_SENSOR_MSG_DENSE_ID
+// Goes through the active SensorMsgQueue if there is one, so only for messages whose result the
+// sender does not need. The message arrives as a bare SensorMsg carrying the ID, which only the ID
+// based isMsg tests recognize, so only the messages of SensorMsgCategory::cDeferrable are sent.
+// Returns false without sending anything for other messages.
+bool sendMsgDeferrable(SensorMsgId msgId, HitSensor* receiver, HitSensor* sender);
+#endif
+
 bool isMsgPushAll(const SensorMsg* msg);
 bool isMsgPush(const SensorMsg* msg);
 bool isMsgPushStrong(const SensorMsg* msg);
@@ -262,10 +318,13 @@ bool isMsgEnemyUpperPunch(const SensorMsg* msg);
 bool isMsgPlayerTrample(const SensorMsg* msg);
 bool isMsgPlayerTrampleReflect(const SensorMsg* msg);
 bool isMsgPlayerHipDropAll(const SensorMsg* msg);
+bool isMsgPlayerHipDrop(const SensorMsg* msg);
 bool isMsgPlayerStatueDrop(const SensorMsg* msg);
 bool isMsgPlayerObjHipDropAll(const SensorMsg* msg);
+bool isMsgPlayerObjHipDrop(const SensorMsg* msg);
 bool isMsgPlayerObjStatueDrop(const SensorMsg* msg);
 bool isMsgPlayerObjHipDropReflectAll(const SensorMsg* msg);
+bool isMsgPlayerObjHipDropReflect(const SensorMsg* msg);
 bool isMsgPlayerObjStatueDropReflect(const SensorMsg* msg);
 bool isMsgPlayerObjHipDropHighJump(const SensorMsg* msg);
 bool isMsgPlayerHipDropKnockDown(const SensorMsg* msg);
@@ -4,6 +4,9 @@
 #include "Library/Area/SwitchAreaDirector.h"
 #include "Library/Camera/CameraDirector.h"
 #include "Library/Collision/CollisionDirector.h"
+#ifdef AL_COLLISION_AABB_TREE
+#include "Library/Collision/CollisionPartsKeeperAabbTree.h"
+#endif
 #include "Library/Controller/PadRumbleDirector.h"
 #include "Library/Draw/GraphicsSystemInfo.h"
 #include "Library/Effect/EffectSystem.h"
@@ -89,6 +92,9 @@ void LiveActorKit::init(s32 maxCameras) {
     mExecutorCore2 = new ExecuteAsyncExecutorUpdate(mExecuteDirector, "ビュー更新(コア2)", 2);
     mAreaObjDirector = new AreaObjDirector();
     mCollisionDirector = new CollisionDirector(mExecuteDirector);
+#ifdef AL_COLLISION_AABB_TREE
+    mCollisionDirector->setPartsKeeper(new CollisionPartsKeeperAabbTree(mMaxActors));
+#endif
     mCameraDirector = new CameraDirector(maxCameras);
 
     if (mEffectSystem) {
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#include "Library/LiveActor/ActorSensorMsgFunction.h"
+
+// Needs the message IDs, which are only there with AL_SENSOR_MSG_DENSE_ID.
+#ifdef AL_SENSOR_MSG_DENSE_ID
+
+namespace al {
+class HitSensor;
+
+// Maps message IDs to member functions of an actor, so that receiveMsg jumps straight to the
+// handler of a message instead of testing it against every message the actor handles. The
+// entries are only referenced, so they must outlive the table:
+//
+//   static const SensorMsgHandlerTable<Foo>::Entry sEntries[] = {
+//       {SensorMsgId::Push, &Foo::receiveMsgPush},
+//       {SensorMsgId::PlayerTrample, &Foo::receiveMsgTrample},
+//   };
+//   static const SensorMsgHandlerTable<Foo> sHandlerTable(sEntries);
+template <typename T>
+class SensorMsgHandlerTable {
+public:
+    using Handler = bool (T::*)(const SensorMsg* message, HitSensor* other, HitSensor* self);
+
+    struct Entry {
+        SensorMsgId msgId;
+        Handler handler;
+    };
+
+    template <s32 N>
+    SensorMsgHandlerTable(const Entry (&entries)[N]) : mEntries(entries) {
+        static_assert(N < 0x100, "Entries are indexed by u8");
+        for (s32 i = 0; i <= cSensorMsgIdNum; i++)
+            mEntryIndices[i] = 0;
+        for (s32 i = 0; i < N; i++)
+            if (entries[i].msgId < SensorMsgId::Invalid)
+                mEntryIndices[static_cast<s32>(entries[i].msgId)] = i + 1;
+    }
+
+    bool isHandled(const SensorMsg* message) const {
+        return mEntryIndices[static_cast<s32>(message->getMsgId())] != 0;
+    }
+
+    // Returns false without calling anything if the actor has no handler for the message. Messages
+    // without an ID never have a handler here, the actor has to test those itself.
+    bool tryReceiveMsg(T* actor, const SensorMsg* message, HitSensor* other,
+                       HitSensor* self) const {
+        s32 index = mEntryIndices[static_cast<s32>(message->getMsgId())];
+        if (index == 0)
+            return false;
+        return (actor->*mEntries[index - 1].handler)(message, other, self);
+    }
+
+private:
+    const Entry* mEntries;
+    // one past the index of the entry of every ID, zero for none. Invalid never has an entry
+    u8 mEntryIndices[cSensorMsgIdNum + 1];
+};
+
+}  // namespace al
+
+#endif
@@ -0,0 +1,240 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+namespace al {
+
+// Groups of messages that are tested together, like isMsgPushAll. cDeferrable marks the messages
+// without a payload that sendMsgDeferrable can queue, see there.
+struct SensorMsgCategory {
+    enum Enum : u32 {
+        cPushAll = 1 << 0,
+        cHoldReleaseAll = 1 << 1,
+        cItemGetDirectAll = 1 << 2,
+        cItemGetByObjAll = 1 << 3,
+        cFloorTouch = 1 << 4,
+        cUpperPunch = 1 << 5,
+        cPlayerHipDropAll = 1 << 6,
+        cPlayerObjHipDropAll = 1 << 7,
+        cPlayerObjHipDropReflectAll = 1 << 8,
+        cTouchAssistAll = 1 << 9,
+        cDeferrable = 1 << 10,
+        cItemGetAll = cItemGetDirectAll | cItemGetByObjAll,
+    };
+};
+
+// Every message type with its categories, one dense ID each in this order.
+#define AL_SENSOR_MSG_LIST(X)                                                                      \
+    X(Push, SensorMsgCategory::cPushAll | SensorMsgCategory::cDeferrable)                          \
+    X(PushStrong, SensorMsgCategory::cPushAll | SensorMsgCategory::cDeferrable)                    \
+    X(PushVeryStrong, SensorMsgCategory::cPushAll | SensorMsgCategory::cDeferrable)                \
+    X(HoldCancel, SensorMsgCategory::cHoldReleaseAll)                                              \
+    X(PlayerRelease, SensorMsgCategory::cHoldReleaseAll)                                           \
+    X(PlayerReleaseBySwing, SensorMsgCategory::cHoldReleaseAll)                                    \
+    X(PlayerReleaseDead, SensorMsgCategory::cHoldReleaseAll)                                       \
+    X(PlayerReleaseDamage, SensorMsgCategory::cHoldReleaseAll)                                     \
+    X(PlayerReleaseDemo, SensorMsgCategory::cHoldReleaseAll)                                       \
+    X(PlayerItemGet, SensorMsgCategory::cItemGetDirectAll)                                         \
+    X(RideAllPlayerItemGet, SensorMsgCategory::cItemGetDirectAll)                                  \
+    X(PlayerTailAttack, SensorMsgCategory::cItemGetDirectAll)                                      \
+    X(BallItemGet, SensorMsgCategory::cItemGetByObjAll)                                            \
+    X(KickKouraItemGet, SensorMsgCategory::cItemGetByObjAll)                                       \
+    X(KillerItemGet, SensorMsgCategory::cItemGetByObjAll)                                          \
+    X(PlayerFloorTouch, SensorMsgCategory::cFloorTouch | SensorMsgCategory::cDeferrable)           \
+    X(EnemyFloorTouch, SensorMsgCategory::cFloorTouch | SensorMsgCategory::cDeferrable)            \
+    X(PlayerUpperPunch, SensorMsgCategory::cUpperPunch)                                            \
+    X(EnemyUpperPunch, SensorMsgCategory::cUpperPunch)                                             \
+    X(PlayerTrample, 0)                                                                            \
+    X(PlayerTrampleReflect, 0)                                                                     \
+    X(PlayerHipDrop, SensorMsgCategory::cPlayerHipDropAll)                                         \
+    X(PlayerStatueDrop, SensorMsgCategory::cPlayerHipDropAll)                                      \
+    X(PlayerObjHipDrop, SensorMsgCategory::cPlayerObjHipDropAll)                                   \
+    X(PlayerObjStatueDrop, SensorMsgCategory::cPlayerObjHipDropAll)                                \
+    X(PlayerObjHipDropReflect, SensorMsgCategory::cPlayerObjHipDropReflectAll)                     \
+    X(PlayerObjStatueDropReflect, SensorMsgCategory::cPlayerObjHipDropReflectAll)                  \
+    X(PlayerObjHipDropHighJump, 0)                                                                 \
+    X(PlayerHipDropKnockDown, 0)                                                                   \
+    X(PlayerObjStatueDropReflectNoCondition, 0)                                                    \
+    X(PlayerStatueTouch, 0)                                                                        \
+    X(PlayerObjUpperPunch, 0)                                                                      \
+    X(PlayerRollingAttack, 0)                                                                      \
+    X(PlayerRollingReflect, 0)                                                                     \
+    X(PlayerObjRollingAttack, 0)                                                                   \
+    X(PlayerObjRollingAttackFailure, 0)                                                            \
+    X(PlayerInvincibleAttack, 0)                                                                   \
+    X(PlayerFireBallAttack, 0)                                                                     \
+    X(PlayerRouteDokanFireBallAttack, 0)                                                           \
+    X(PlayerKick, 0)                                                                               \
+    X(PlayerCatch, 0)                                                                              \
+    X(PlayerSlidingAttack, 0)                                                                      \
+    X(PlayerBoomerangAttack, 0)                                                                    \
+    X(PlayerBoomerangAttackCollide, 0)                                                             \
+    X(PlayerBoomerangReflect, 0)                                                                   \
+    X(PlayerBoomerangBreak, 0)                                                                     \
+    X(PlayerBodyAttack, 0)                                                                         \
+    X(PlayerBodyLanding, 0)                                                                        \
+    X(PlayerBodyAttackReflect, 0)                                                                  \
+    X(PlayerClimbAttack, 0)                                                                        \
+    X(PlayerSpinAttack, 0)                                                                         \
+    X(PlayerGiantAttack, 0)                                                                        \
+    X(PlayerCooperationHipDrop, 0)                                                                 \
+    X(PlayerClimbSlidingAttack, 0)                                                                 \
+    X(PlayerClimbRollingAttack, 0)                                                                 \
+    X(PlayerGiantHipDrop, 0)                                                                       \
+    X(PlayerDisregard, 0)                                                                          \
+    X(PlayerDash, 0)                                                                               \
+    X(PlayerDamageTouch, 0)                                                                        \
+    X(PlayerFloorTouchBind, 0)                                                                     \
+    X(PlayerTouch, SensorMsgCategory::cDeferrable)                                                 \
+    X(PlayerInvincibleTouch, 0)                                                                    \
+    X(PlayerGiantTouch, 0)                                                                         \
+    X(PlayerObjTouch, 0)                                                                           \
+    X(PlayerPutOnEquipment, 0)                                                                     \
+    X(PlayerReleaseEquipment, 0)                                                                   \
+    X(PlayerReleaseEquipmentGoal, 0)                                                               \
+    X(PlayerCarryFront, 0)                                                                         \
+    X(PlayerCarryFrontWallKeep, 0)                                                                 \
+    X(PlayerCarryUp, 0)                                                                            \
+    X(PlayerCarryKeepDemo, 0)                                                                      \
+    X(PlayerCarryWarp, 0)                                                                          \
+    X(PlayerLeave, 0)                                                                              \
+    X(PlayerToss, 0)                                                                               \
+    X(EnemyAttack, 0)                                                                              \
+    X(EnemyAttackFire, 0)                                                                          \
+    X(EnemyAttackKnockDown, 0)                                                                     \
+    X(EnemyAttackBoomerang, 0)                                                                     \
+    X(EnemyAttackNeedle, 0)                                                                        \
+    X(EnemyItemGet, 0)                                                                             \
+    X(EnemyRouteDokanAttack, 0)                                                                    \
+    X(EnemyRouteDokanFire, 0)                                                                      \
+    X(Explosion, 0)                                                                                \
+    X(ExplosionCollide, 0)                                                                         \
+    X(BindStart, 0)                                                                                \
+    X(BindInit, 0)                                                                                 \
+    X(BindEnd, 0)                                                                                  \
+    X(BindCancel, 0)                                                                               \
+    X(BindCancelByDemo, 0)                                                                         \
+    X(BindDamage, 0)                                                                               \
+    X(BindSteal, 0)                                                                                \
+    X(BindGiant, 0)                                                                                \
+    X(PressureDeath, 0)                                                                            \
+    X(NpcTouch, SensorMsgCategory::cDeferrable)                                                    \
+    X(Hit, 0)                                                                                      \
+    X(HitStrong, 0)                                                                                \
+    X(HitVeryStrong, 0)                                                                            \
+    X(KnockDown, 0)                                                                                \
+    X(MapPush, 0)                                                                                  \
+    X(Vanish, 0)                                                                                   \
+    X(ChangeAlpha, 0)                                                                              \
+    X(ShowModel, 0)                                                                                \
+    X(HideModel, 0)                                                                                \
+    X(Restart, 0)                                                                                  \
+    X(EnemyTouch, SensorMsgCategory::cDeferrable)                                                  \
+    X(EnemyTrample, 0)                                                                             \
+    X(MapObjTrample, 0)                                                                            \
+    X(NeedleBallAttack, 0)                                                                         \
+    X(PunpunFloorTouch, 0)                                                                         \
+    X(InvalidateFootPrint, 0)                                                                      \
+    X(KickKouraAttack, 0)                                                                          \
+    X(KickKouraAttackCollide, 0)                                                                   \
+    X(KickKouraReflect, 0)                                                                         \
+    X(KickKouraCollideNoReflect, 0)                                                                \
+    X(KickKouraBreak, 0)                                                                           \
+    X(KickKouraBlow, 0)                                                                            \
+    X(KickStoneAttack, 0)                                                                          \
+    X(KickStoneAttackCollide, 0)                                                                   \
+    X(KickStoneAttackHold, 0)                                                                      \
+    X(KickStoneAttackReflect, 0)                                                                   \
+    X(KickStoneTrample, 0)                                                                         \
+    X(KillerAttack, 0)                                                                             \
+    X(LiftGeyser, 0)                                                                               \
+    X(WarpStart, 0)                                                                                \
+    X(WarpEnd, 0)                                                                                  \
+    X(HoleIn, 0)                                                                                   \
+    X(JumpInhibit, 0)                                                                              \
+    X(GoalKill, 0)                                                                                 \
+    X(Goal, 0)                                                                                     \
+    X(BallAttack, 0)                                                                               \
+    X(BallRouteDokanAttack, 0)                                                                     \
+    X(BallAttackHold, 0)                                                                           \
+    X(BallAttackDRCHold, 0)                                                                        \
+    X(BallAttackCollide, 0)                                                                        \
+    X(BallTrample, 0)                                                                              \
+    X(BallTrampleCollide, 0)                                                                       \
+    X(FireBallCollide, 0)                                                                          \
+    X(FireBallFloorTouch, 0)                                                                       \
+    X(DokanBazookaAttack, 0)                                                                       \
+    X(SwitchOn, 0)                                                                                 \
+    X(SwitchOnInit, 0)                                                                             \
+    X(SwitchOffInit, 0)                                                                            \
+    X(SwitchKillOn, 0)                                                                             \
+    X(SwitchKillOnInit, 0)                                                                         \
+    X(SwitchKillOffInit, 0)                                                                        \
+    X(AskSafetyPoint, 0)                                                                           \
+    X(TouchAssist, SensorMsgCategory::cTouchAssistAll)                                             \
+    X(TouchAssistNoPat, SensorMsgCategory::cTouchAssistAll)                                        \
+    X(TouchAssistTrig, SensorMsgCategory::cTouchAssistAll)                                         \
+    X(TouchAssistTrigOff, SensorMsgCategory::cTouchAssistAll)                                      \
+    X(TouchAssistTrigNoPat, SensorMsgCategory::cTouchAssistAll)                                    \
+    X(TouchAssistBurn, SensorMsgCategory::cTouchAssistAll)                                         \
+    X(TouchCarryItem, 0)                                                                           \
+    X(TouchReleaseItem, 0)                                                                         \
+    X(TouchStroke, 0)                                                                              \
+    X(IsNerveSupportFreeze, 0)                                                                     \
+    X(OnSyncSupportFreeze, 0)                                                                      \
+    X(OffSyncSupportFreeze, 0)                                                                     \
+    X(ScreenPointInvalidCollisionParts, 0)                                                         \
+    X(BlockUpperPunch, 0)                                                                          \
+    X(BlockLowerPunch, 0)                                                                          \
+    X(BlockItemGet, 0)                                                                             \
+    X(PlayerKouraAttack, 0)                                                                        \
+    X(LightFlash, 0)                                                                               \
+    X(ForceAbyss, 0)                                                                               \
+    X(SwordAttackHigh, 0)                                                                          \
+    X(SwordAttackHighLeft, 0)                                                                      \
+    X(SwordAttackHighRight, 0)                                                                     \
+    X(SwordAttackLow, 0)                                                                           \
+    X(SwordAttackLowLeft, 0)                                                                       \
+    X(SwordAttackLowRight, 0)                                                                      \
+    X(SwordBeamAttack, 0)                                                                          \
+    X(SwordBeamReflectAttack, 0)                                                                   \
+    X(SwordAttackJumpUnder, 0)                                                                     \
+    X(ShieldGuard, 0)                                                                              \
+    X(AskMultiPlayerEnemy, 0)                                                                      \
+    X(ItemGettable, 0)                                                                             \
+    X(KikkiThrow, 0)                                                                               \
+    X(IsKikkiThrowTarget, 0)                                                                       \
+    X(PlayerCloudGet, 0)                                                                           \
+    X(AutoJump, 0)                                                                                 \
+    X(PlayerTouchShadow, 0)                                                                        \
+    X(PlayerPullOutShadow, 0)                                                                      \
+    X(PlayerAttackShadow, 0)                                                                       \
+    X(PlayerAttackShadowStrong, 0)                                                                 \
+    X(PlayerAttackChangePos, 0)                                                                    \
+    X(AtmosOnlineLight, 0)                                                                         \
+    X(LightBurn, 0)                                                                                \
+    X(MoonLightBurn, 0)                                                                            \
+    X(String, 0)                                                                                   \
+    X(StringV4fPtr, 0)                                                                             \
+    X(StringV4fSensorPtr, 0)                                                                       \
+    X(StringVoidPtr, 0)
+
+enum class SensorMsgId : u16 {
+#define AL_SENSOR_MSG_ID(Type, Categories) Type,
+    AL_SENSOR_MSG_LIST(AL_SENSOR_MSG_ID)
+#undef AL_SENSOR_MSG_ID
+    // messages that were not given an ID, which are only told apart through RTTI
+    Invalid,
+};
+
+constexpr s32 cSensorMsgIdNum = static_cast<s32>(SensorMsgId::Invalid);
+
+// Indexed by SensorMsgId, including Invalid.
+inline constexpr u32 cSensorMsgCategoryMasks[] = {
+#define AL_SENSOR_MSG_CATEGORIES(Type, Categories) Categories,
+    AL_SENSOR_MSG_LIST(AL_SENSOR_MSG_CATEGORIES)
+#undef AL_SENSOR_MSG_CATEGORIES
+    0,
+};
+
+}  // namespace al
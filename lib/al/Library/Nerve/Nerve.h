@@ -7,5 +7,9 @@ class Nerve {
 public:
     virtual void execute(NerveKeeper* keeper) const = 0;
     virtual void executeOnEnd(NerveKeeper* keeper) const;
+#ifdef AL_NERVE_TRACE
+    // Overridden by the NERVE_IMPL macros.
+    virtual const char* getTraceName() const { return nullptr; }
+#endif
 };
 }  // namespace al
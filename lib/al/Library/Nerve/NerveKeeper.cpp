@@ -2,12 +2,16 @@
 
 #include "Library/Nerve/Nerve.h"
 #include "Library/Nerve/NerveStateCtrl.h"
+#include "Library/Nerve/NerveTrace.h"
 
 namespace al {
 NerveKeeper::NerveKeeper(IUseNerve* parent, const Nerve* nerve, s32 maxStates)
     : mParent(parent), mNextNerve(nerve) {
     if (maxStates > 0)
         mStateCtrl = new NerveStateCtrl(maxStates);
+#ifdef AL_NERVE_TRACE
+    mTraceBuffer = new NerveTraceBuffer();
+#endif
 }
 
 void NerveKeeper::initNerveAction(NerveActionCtrl* actionCtrl) {
@@ -15,8 +19,10 @@ void NerveKeeper::initNerveAction(NerveActionCtrl* actionCtrl) {
 }
 
 void NerveKeeper::setNerve(const Nerve* nextNerve) {
-    if (mStep >= 0 && mCurrentNerve != nullptr)
+    if (mStep >= 0 && mCurrentNerve != nullptr) {
         mCurrentNerve->executeOnEnd(this);
+        AL_NERVE_TRACE_END(mCurrentNerve, mStep);
+    }
 
     mNextNerve = nextNerve;
     mStep = -1;
@@ -36,7 +42,10 @@ void NerveKeeper::tryChangeNerve() {
 
 void NerveKeeper::update() {
     tryChangeNerve();
-    mCurrentNerve->execute(this);
+    {
+        AL_NERVE_TRACE_SCOPE(mTraceBuffer, mCurrentNerve, mStep);
+        mCurrentNerve->execute(this);
+    }
     mStep++;
     tryChangeNerve();
 }
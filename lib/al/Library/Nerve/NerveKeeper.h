@@ -7,6 +7,7 @@ class IUseNerve;
 class Nerve;
 class NerveStateCtrl;
 class NerveActionCtrl;
+class NerveTraceBuffer;
 
 class NerveKeeper {
 public:
@@ -26,6 +27,10 @@ public:
 
     NerveActionCtrl* getActionCtrl() const { return mActionCtrl; }
 
+#ifdef AL_NERVE_TRACE
+    const NerveTraceBuffer* getTraceBuffer() const { return mTraceBuffer; }
+#endif
+
     template <typename T>
     T* getParent() {
         return static_cast<T*>(mParent);
@@ -38,5 +43,8 @@ private:
     s32 mStep = 0;
     NerveStateCtrl* mStateCtrl = nullptr;
     NerveActionCtrl* mActionCtrl = nullptr;
+#ifdef AL_NERVE_TRACE
+    NerveTraceBuffer* mTraceBuffer = nullptr;
+#endif
 };
 }  // namespace al
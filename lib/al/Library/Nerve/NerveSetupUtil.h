@@ -6,6 +6,7 @@
 #include "Library/Nerve/Nerve.h"
 #include "Library/Nerve/NerveAction.h"
 #include "Library/Nerve/NerveKeeper.h"
+#include "Library/Nerve/NerveTrace.h"
 
 /*
 
@@ -48,6 +49,7 @@ al::initNerveAction(this, "Hide", &NrvExampleUseCase.mCollector, 0);
         void execute(al::NerveKeeper* keeper) const override {                                     \
             (keeper->getParent<Class>())->exe##ActionFunc();                                       \
         }                                                                                          \
+        NERVE_TRACE_NAME(Class, Action)                                                            \
     };
 
 #define NERVE_IMPL(Class, Action) NERVE_IMPL_(Class, Action, Action)
@@ -61,6 +63,7 @@ al::initNerveAction(this, "Hide", &NrvExampleUseCase.mCollector, 0);
         void executeOnEnd(al::NerveKeeper* keeper) const override {                                \
             (keeper->getParent<Class>())->end##ActionFunc();                                       \
         }                                                                                          \
+        NERVE_TRACE_NAME(Class, Action)                                                            \
     };
 
 #define NERVE_END_IMPL(Class, Action) NERVE_END_IMPL_(Class, Action, Action)
@@ -71,6 +74,7 @@ al::initNerveAction(this, "Hide", &NrvExampleUseCase.mCollector, 0);
         void execute(al::NerveKeeper* keeper) const override {                                     \
             (keeper->getParent<Class>())->exe##ActionFunc();                                       \
         }                                                                                          \
+        NERVE_TRACE_NAME(Class, Action)                                                            \
     };
 
 #define NERVE_HOST_TYPE_IMPL(Class, Action) NERVE_HOST_TYPE_IMPL_(Class, Action, Action)
@@ -90,6 +94,7 @@ al::initNerveAction(this, "Hide", &NrvExampleUseCase.mCollector, 0);
         void execute(al::NerveKeeper* keeper) const override {                                     \
             (keeper->getParent<Class>())->exe##ActionFunc();                                       \
         }                                                                                          \
+        NERVE_TRACE_NAME(Class, Action)                                                            \
                                                                                                    \
         const char* getActionName() const override { return #Action; }                             \
     };
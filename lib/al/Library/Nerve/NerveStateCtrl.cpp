@@ -1,6 +1,7 @@
 #include "Library/Nerve/NerveStateCtrl.h"
 
 #include "Library/Nerve/NerveKeeper.h"
+#include "Library/Nerve/NerveTrace.h"
 
 namespace al {
 
@@ -21,6 +22,7 @@ bool NerveStateCtrl::updateCurrentState() {
     if (!mCurrentState)
         return false;
 
+    AL_NERVE_TRACE_STATE_SCOPE(mCurrentState->name);
     return mCurrentState->state->update();
 }
 
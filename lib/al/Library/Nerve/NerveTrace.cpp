@@ -0,0 +1,258 @@
+#include "Library/Nerve/NerveTrace.h"
+
+#ifdef AL_NERVE_TRACE
+
+#include <cstdio>
+#include <nn/os.h>
+
+#include "Library/Nerve/Nerve.h"
+
+namespace al {
+namespace {
+s32 calcHistogramBucket(s64 microSeconds) {
+    s32 bucket = 0;
+    while (microSeconds > 0 && bucket < NerveTrace::cHistogramBucketNum - 1) {
+        microSeconds >>= 1;
+        bucket++;
+    }
+    return bucket;
+}
+
+template <typename T>
+void updateMax(std::atomic<T>& max, T value) {
+    T current = max.load(std::memory_order_relaxed);
+    while (current < value && !max.compare_exchange_weak(current, value, std::memory_order_relaxed))
+        ;
+}
+
+// Appends to the buffer while it has room. Once something does not fit, nothing more is written.
+struct JsonWriter {
+    char* buffer;
+    s32 size;
+    s32 sizeMax;
+    bool isOverflow;
+
+    template <typename... Args>
+    void write(const char* format, Args... args) {
+        if (isOverflow)
+            return;
+
+        s32 rest = sizeMax - size;
+        s32 length = snprintf(buffer + size, rest, format, args...);
+        if (length >= rest)
+            isOverflow = true;
+        else
+            size += length;
+    }
+
+    // drops the partly written element that did not fit, and closes the JSON
+    void close(s32 elementSize, s32 bufferSize) {
+        if (isOverflow)
+            size = elementSize;
+        isOverflow = false;
+        sizeMax = bufferSize;
+        write("%s", "\n]}\n");
+    }
+};
+
+constexpr s32 cFooterSize = sizeof("\n]}\n");
+}  // namespace
+
+void NerveTraceBuffer::add(const Nerve* nerve, s32 step, s64 durationTick) {
+    mEntries[mAddNum % cEntryNum] = {NerveTrace::getFrame(), step, nerve, durationTick};
+    mAddNum++;
+}
+
+s32 NerveTraceBuffer::getEntryNum() const {
+    return mAddNum < (u32)cEntryNum ? mAddNum : cEntryNum;
+}
+
+const NerveTraceEntry& NerveTraceBuffer::getEntry(s32 index) const {
+    return mEntries[(mAddNum - getEntryNum() + index) % cEntryNum];
+}
+
+NerveTrace::Stats NerveTrace::sStats[cStatsNumMax];
+bool NerveTrace::sIsEnable = false;
+std::atomic<u32> NerveTrace::sFrame{0};
+s64 NerveTrace::sTickPerMicroSecond = 1;
+
+void NerveTrace::setEnable(bool isEnable) {
+    s64 tick_per_micro_second = nn::os::GetSystemTickFrequency() / 1000000;
+    sTickPerMicroSecond = tick_per_micro_second > 0 ? tick_per_micro_second : 1;
+    sIsEnable = isEnable;
+}
+
+bool NerveTrace::isEnable() {
+    return sIsEnable;
+}
+
+void NerveTrace::nextFrame() {
+    sFrame.fetch_add(1, std::memory_order_relaxed);
+}
+
+u32 NerveTrace::getFrame() {
+    return sFrame.load(std::memory_order_relaxed);
+}
+
+s64 NerveTrace::getTick() {
+    return nn::os::GetSystemTick().GetInt64Value();
+}
+
+// Actors may be updated on several cores at once, so the stats are found and added lock-free, in
+// a hash table keyed by the nerve or state name. Stats beyond the capacity are not recorded.
+NerveTrace::Stats* NerveTrace::tryFindOrAddStats(const void* key, const char* name, bool isState) {
+    u64 value = reinterpret_cast<uintptr_t>(key);
+    u32 hash = static_cast<u32>((value >> 4) ^ (value >> 32)) * 0x9e3779b1u;
+    for (s32 i = 0; i < cStatsNumMax; i++) {
+        Stats& stats = sStats[(hash + i) % cStatsNumMax];
+        const void* stats_key = stats.key.load(std::memory_order_acquire);
+        if (stats_key == key)
+            return &stats;
+        if (stats_key)
+            continue;
+
+        if (stats.key.compare_exchange_strong(stats_key, key, std::memory_order_acq_rel)) {
+            stats.name = name;
+            stats.isState = isState;
+            return &stats;
+        }
+        if (stats_key == key)
+            return &stats;
+    }
+    return nullptr;
+}
+
+void NerveTrace::recordExecute(const void* key, const char* name, bool isState,
+                               s64 durationTick) {
+    Stats* stats = tryFindOrAddStats(key, name, isState);
+    if (!stats)
+        return;
+
+    stats->executeNum.fetch_add(1, std::memory_order_relaxed);
+    stats->totalTick.fetch_add(durationTick, std::memory_order_relaxed);
+    updateMax(stats->maxTick, durationTick);
+    s32 bucket = calcHistogramBucket(durationTick / sTickPerMicroSecond);
+    stats->histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+}
+
+// Called when the keeper leaves the nerve after stepNum steps.
+void NerveTrace::recordEnd(const Nerve* nerve, s32 stepNum) {
+    Stats* stats = tryFindOrAddStats(nerve, nerve->getTraceName(), false);
+    if (!stats)
+        return;
+
+    stats->endNum.fetch_add(1, std::memory_order_relaxed);
+    stats->totalStepNum.fetch_add(stepNum, std::memory_order_relaxed);
+    updateMax(stats->maxStepNum, stepNum);
+}
+
+void NerveTrace::clear() {
+    for (s32 i = 0; i < cStatsNumMax; i++) {
+        Stats& stats = sStats[i];
+        stats.key.store(nullptr, std::memory_order_relaxed);
+        stats.name = nullptr;
+        stats.executeNum.store(0, std::memory_order_relaxed);
+        stats.totalTick.store(0, std::memory_order_relaxed);
+        stats.maxTick.store(0, std::memory_order_relaxed);
+        stats.endNum.store(0, std::memory_order_relaxed);
+        stats.totalStepNum.store(0, std::memory_order_relaxed);
+        stats.maxStepNum.store(0, std::memory_order_relaxed);
+        for (s32 j = 0; j < cHistogramBucketNum; j++)
+            stats.histogram[j].store(0, std::memory_order_relaxed);
+    }
+}
+
+// Nerves without a name, from classes not made by the NERVE_IMPL macros, are named by address.
+s32 NerveTrace::writeJson(char* buffer, s32 bufferSize) {
+    if (bufferSize < 64)
+        return 0;
+
+    JsonWriter writer = {buffer, 0, bufferSize - cFooterSize, false};
+    writer.write("{\"frame\":%u,\"nerves\":[", getFrame());
+    s32 size = writer.size;
+    bool is_first = true;
+    for (s32 i = 0; i < cStatsNumMax && !writer.isOverflow; i++) {
+        const Stats& stats = sStats[i];
+        const void* key = stats.key.load(std::memory_order_acquire);
+        if (!key || stats.executeNum.load(std::memory_order_relaxed) == 0)
+            continue;
+
+        writer.write("%s\n{\"name\":", is_first ? "" : ",");
+        if (stats.name)
+            writer.write("\"%s\"", stats.name);
+        else
+            writer.write("\"%p\"", key);
+        writer.write(",\"isState\":%s,\"executeNum\":%u,\"totalMicroSeconds\":%lld,"
+                     "\"maxMicroSeconds\":%lld,\"endNum\":%u,\"totalStepNum\":%u,"
+                     "\"maxStepNum\":%d,\"histogram\":[",
+                     stats.isState ? "true" : "false", stats.executeNum.load(),
+                     (long long)(stats.totalTick.load() / sTickPerMicroSecond),
+                     (long long)(stats.maxTick.load() / sTickPerMicroSecond), stats.endNum.load(),
+                     stats.totalStepNum.load(), stats.maxStepNum.load());
+        for (s32 j = 0; j < cHistogramBucketNum; j++)
+            writer.write(j == 0 ? "%u" : ",%u", stats.histogram[j].load());
+        writer.write("]}");
+        if (!writer.isOverflow)
+            size = writer.size;
+        is_first = false;
+    }
+
+    writer.close(size, bufferSize);
+    return writer.size;
+}
+
+s32 NerveTrace::writeBufferJson(const NerveTraceBuffer* traceBuffer, char* buffer,
+                                s32 bufferSize) {
+    if (bufferSize < 64)
+        return 0;
+
+    JsonWriter writer = {buffer, 0, bufferSize - cFooterSize, false};
+    writer.write("{\"entries\":[");
+    s32 size = writer.size;
+    for (s32 i = 0; i < traceBuffer->getEntryNum() && !writer.isOverflow; i++) {
+        const NerveTraceEntry& entry = traceBuffer->getEntry(i);
+        const char* name = entry.nerve->getTraceName();
+        writer.write("%s\n{\"frame\":%u,\"nerve\":", i == 0 ? "" : ",", entry.frame);
+        if (name)
+            writer.write("\"%s\"", name);
+        else
+            writer.write("\"%p\"", entry.nerve);
+        writer.write(",\"step\":%d,\"microSeconds\":%lld}", entry.step,
+                     (long long)(entry.durationTick / sTickPerMicroSecond));
+        if (!writer.isOverflow)
+            size = writer.size;
+    }
+
+    writer.close(size, bufferSize);
+    return writer.size;
+}
+
+NerveTraceScope::NerveTraceScope(NerveTraceBuffer* traceBuffer, const Nerve* nerve, s32 step)
+    : mTraceBuffer(traceBuffer), mNerve(nerve), mStep(step) {
+    if (NerveTrace::isEnable())
+        mBeginTick = NerveTrace::getTick();
+}
+
+NerveTraceScope::NerveTraceScope(const char* stateName) : mStateName(stateName) {
+    if (NerveTrace::isEnable())
+        mBeginTick = NerveTrace::getTick();
+}
+
+NerveTraceScope::~NerveTraceScope() {
+    if (mBeginTick < 0)
+        return;
+
+    s64 duration_tick = NerveTrace::getTick() - mBeginTick;
+    if (mStateName) {
+        NerveTrace::recordExecute(mStateName, mStateName, true, duration_tick);
+        return;
+    }
+
+    if (mTraceBuffer)
+        mTraceBuffer->add(mNerve, mStep, duration_tick);
+    NerveTrace::recordExecute(mNerve, mNerve->getTraceName(), false, duration_tick);
+}
+
+}  // namespace al
+
+#endif
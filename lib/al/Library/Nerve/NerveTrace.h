@@ -0,0 +1,112 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#ifdef AL_NERVE_TRACE
+#include <atomic>
+#endif
+
+namespace al {
+class Nerve;
+
+// Records which nerves ran, at which step and for how long. Every nerve keeper keeps its last
+// executions in a ring, and every nerve and state gets execution and step counts and a histogram
+// of its execution times, which writeJson exports. Builds without AL_NERVE_TRACE compile every
+// recording out.
+#ifdef AL_NERVE_TRACE
+struct NerveTraceEntry {
+    u32 frame;
+    s32 step;
+    const Nerve* nerve;
+    s64 durationTick;
+};
+
+class NerveTraceBuffer {
+public:
+    static constexpr s32 cEntryNum = 16;
+
+    void add(const Nerve* nerve, s32 step, s64 durationTick);
+    s32 getEntryNum() const;
+    // oldest first
+    const NerveTraceEntry& getEntry(s32 index) const;
+
+private:
+    NerveTraceEntry mEntries[cEntryNum];
+    u32 mAddNum = 0;
+};
+
+class NerveTrace {
+public:
+    static constexpr s32 cStatsNumMax = 4096;
+    // execution times of 0-1 us, 1-2 us, 2-4 us, ..., and 16384 us or more
+    static constexpr s32 cHistogramBucketNum = 16;
+
+    static void setEnable(bool isEnable);
+    static bool isEnable();
+    static void nextFrame();
+    static u32 getFrame();
+    static s64 getTick();
+    static void recordExecute(const void* key, const char* name, bool isState, s64 durationTick);
+    static void recordEnd(const Nerve* nerve, s32 stepNum);
+    static void clear();
+    // Call between frames. Both return the length of the closed JSON, or 0 for buffers under 64
+    // bytes.
+    static s32 writeJson(char* buffer, s32 bufferSize);
+    static s32 writeBufferJson(const NerveTraceBuffer* traceBuffer, char* buffer, s32 bufferSize);
+
+private:
+    struct Stats {
+        std::atomic<const void*> key;
+        const char* name;
+        bool isState;
+        std::atomic<u32> executeNum;
+        std::atomic<s64> totalTick;
+        std::atomic<s64> maxTick;
+        std::atomic<u32> endNum;
+        std::atomic<u32> totalStepNum;
+        std::atomic<s32> maxStepNum;
+        std::atomic<u32> histogram[cHistogramBucketNum];
+    };
+
+    static Stats* tryFindOrAddStats(const void* key, const char* name, bool isState);
+
+    static Stats sStats[cStatsNumMax];
+    static bool sIsEnable;
+    static std::atomic<u32> sFrame;
+    static s64 sTickPerMicroSecond;
+};
+
+class NerveTraceScope {
+public:
+    NerveTraceScope(NerveTraceBuffer* traceBuffer, const Nerve* nerve, s32 step);
+    NerveTraceScope(const char* stateName);
+    ~NerveTraceScope();
+
+private:
+    NerveTraceBuffer* mTraceBuffer = nullptr;
+    const Nerve* mNerve = nullptr;
+    const char* mStateName = nullptr;
+    s32 mStep = 0;
+    s64 mBeginTick = -1;
+};
+
+#define AL_NERVE_TRACE_SCOPE(traceBuffer, nerve, step)                                             \
+    al::NerveTraceScope nerveTraceScope(traceBuffer, nerve, step)
+#define AL_NERVE_TRACE_STATE_SCOPE(stateName) al::NerveTraceScope nerveTraceScope(stateName)
+#define AL_NERVE_TRACE_NEXT_FRAME() al::NerveTrace::nextFrame()
+#define AL_NERVE_TRACE_END(nerve, stepNum)                                                         \
+    do {                                                                                           \
+        if (al::NerveTrace::isEnable())                                                            \
+            al::NerveTrace::recordEnd(nerve, stepNum);                                             \
+    } while (0)
+#define NERVE_TRACE_NAME(Class, Action)                                                            \
+    const char* getTraceName() const override { return #Class "::" #Action; }
+#else
+#define AL_NERVE_TRACE_SCOPE(traceBuffer, nerve, step)
+#define AL_NERVE_TRACE_STATE_SCOPE(stateName)
+#define AL_NERVE_TRACE_NEXT_FRAME()
+#define AL_NERVE_TRACE_END(nerve, stepNum)
+#define NERVE_TRACE_NAME(Class, Action)
+#endif
+
+}  // namespace al
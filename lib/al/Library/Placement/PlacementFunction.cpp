@@ -4,6 +4,8 @@
 #include "Library/Placement/PlacementId.h"
 #include "Library/Placement/PlacementInfo.h"
 #include "Library/Yaml/ByamlIter.h"
+#include "Library/Yaml/ByamlKeyHandle.h"
+#include "Library/Yaml/ByamlUtil.h"
 
 namespace al {
 s32 getCountPlacementInfo(const PlacementInfo& rInfo) {
@@ -69,6 +71,48 @@ bool tryGetPlacementInfoAndKeyNameByIndex(PlacementInfo* pOutInfo, const char**
     return result;
 }
 
+bool tryGetArg(s32* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key) {
+    return tryGetArg(arg, initInfo.getPlacementInfo(), key);
+}
+
+bool tryGetArg(s32* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key) {
+    return tryGetByamlS32(arg, placementInfo.getPlacementIter(), key);
+}
+
+bool tryGetArg(f32* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key) {
+    return tryGetArg(arg, initInfo.getPlacementInfo(), key);
+}
+
+bool tryGetArg(f32* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key) {
+    return tryGetByamlF32(arg, placementInfo.getPlacementIter(), key);
+}
+
+bool tryGetArg(bool* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key) {
+    return tryGetArg(arg, initInfo.getPlacementInfo(), key);
+}
+
+bool tryGetArg(bool* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key) {
+    return tryGetByamlBool(arg, placementInfo.getPlacementIter(), key);
+}
+
+bool tryGetArgV3f(sead::Vector3f* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key) {
+    return tryGetArgV3f(arg, initInfo.getPlacementInfo(), key);
+}
+
+bool tryGetArgV3f(sead::Vector3f* arg, const PlacementInfo& placementInfo,
+                  const ByamlKeyHandle& key) {
+    return tryGetByamlV3f(arg, placementInfo.getPlacementIter(), key);
+}
+
+bool tryGetStringArg(const char** arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key) {
+    return tryGetStringArg(arg, initInfo.getPlacementInfo(), key);
+}
+
+bool tryGetStringArg(const char** arg, const PlacementInfo& placementInfo,
+                     const ByamlKeyHandle& key) {
+    return tryGetByamlString(arg, placementInfo.getPlacementIter(), key);
+}
+
 PlacementId* createPlacementId(const ActorInitInfo& rInfo) {
     const PlacementInfo& info = rInfo.getPlacementInfo();
     PlacementId* id = new PlacementId();
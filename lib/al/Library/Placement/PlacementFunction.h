@@ -7,6 +7,7 @@
 namespace al {
 class ActorInitInfo;
 class AreaInitInfo;
+class ByamlKeyHandle;
 class PlacementInfo;
 class PlacementId;
 
@@ -98,6 +99,18 @@ bool getArg(bool* arg, const ActorInitInfo& initInfo, const char* key);
 bool getArg(bool* arg, const PlacementInfo& placementInfo, const char* key);
 bool tryGetArg(bool* arg, const ActorInitInfo& initInfo, const char* key);
 bool tryGetArg(bool* arg, const PlacementInfo& placementInfo, const char* key);
+bool tryGetArg(s32* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key);
+bool tryGetArg(s32* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key);
+bool tryGetArg(f32* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key);
+bool tryGetArg(f32* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key);
+bool tryGetArg(bool* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key);
+bool tryGetArg(bool* arg, const PlacementInfo& placementInfo, const ByamlKeyHandle& key);
+bool tryGetArgV3f(sead::Vector3f* arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key);
+bool tryGetArgV3f(sead::Vector3f* arg, const PlacementInfo& placementInfo,
+                  const ByamlKeyHandle& key);
+bool tryGetStringArg(const char** arg, const ActorInitInfo& initInfo, const ByamlKeyHandle& key);
+bool tryGetStringArg(const char** arg, const PlacementInfo& placementInfo,
+                     const ByamlKeyHandle& key);
 
 s32 getArgS32(const ActorInitInfo& actorInitInfo, const char* key);
 f32 getArgF32(const ActorInitInfo& actorInitInfo, const char* key);
@@ -8,7 +8,52 @@
 
 #include "Library/File/FileUtil.h"
 
+#ifdef AL_BYAML_HOST_ORDER_ONLY
+#include "Library/Yaml/ByamlUtil.h"
+#endif
+
 namespace al {
+#ifdef AL_BYAML_HOST_ORDER_ONLY
+namespace {
+bool isBymlFileName(const sead::SafeString& name) {
+    return name.endsWith(".byml") || name.endsWith(".byaml");
+}
+
+// Brings every BYAML of the archive into host byte order once at load time, as ByamlIter no longer
+// swaps on access in these builds. Files that fail the check are left as they are and get rejected
+// when they are opened.
+void normalizeBymlByteOrder(sead::ArchiveRes* archive, sead::FileDevice* device,
+                            const sead::SafeString& dirPath, sead::Heap* heap) {
+    sead::DirectoryHandle handle;
+    if (!device->tryOpenDirectory(&handle, dirPath))
+        return;
+
+    sead::DirectoryEntry entry;
+    u32 read_num = 0;
+    while (device->tryReadDirectory(&read_num, &handle, &entry, 1) && read_num != 0) {
+        sead::FixedSafeString<256> entry_path;
+        if (dirPath.isEmpty())
+            entry_path.copy(entry.name);
+        else
+            entry_path.format("%s/%s", dirPath.cstr(), entry.name.cstr());
+
+        if (entry.is_directory) {
+            normalizeBymlByteOrder(archive, device, entry_path, heap);
+            continue;
+        }
+        if (!isBymlFileName(entry_path))
+            continue;
+
+        sead::ArchiveRes::FileInfo info;
+        u8* data = static_cast<u8*>(archive->getFile(entry_path, &info));
+        if (data)
+            normalizeByamlByteOrder(data, info.getLength(), heap);
+    }
+    device->tryCloseDirectory(&handle);
+}
+}  // namespace
+#endif
+
 Resource::Resource(const sead::SafeString& path)
     : mArchive(nullptr), mDevice(nullptr), mName(path) {
     mHeap = sead::HeapMgr::sInstancePtr->getCurrentHeap();
@@ -16,6 +61,9 @@ Resource::Resource(const sead::SafeString& path)
     mResFile = nullptr;
     mArchive = loadArchive(path);
     mDevice = new sead::ArchiveFileDevice(mArchive);
+#ifdef AL_BYAML_HOST_ORDER_ONLY
+    normalizeBymlByteOrder(mArchive, mDevice, "", mHeap);
+#endif
 }
 
 Resource::Resource(const sead::SafeString& path, sead::ArchiveRes* archive)
@@ -25,6 +73,9 @@ Resource::Resource(const sead::SafeString& path, sead::ArchiveRes* archive)
     mResFile = nullptr;
     mArchive = archive;
     mDevice = new sead::ArchiveFileDevice(mArchive);
+#ifdef AL_BYAML_HOST_ORDER_ONLY
+    normalizeBymlByteOrder(mArchive, mDevice, "", mHeap);
+#endif
 }
 
 bool Resource::isExistFile(const sead::SafeString& path) const {
@@ -2,13 +2,15 @@
 
 #include <byteswap.h>
 
+#include "Library/Yaml/ByamlData.h"
+
 namespace al {
 s32 ByamlContainerHeader::getType() const {
     return mType;
 }
 
 s32 ByamlContainerHeader::getCount(bool isRev) const {
-    if (isRev)
+    if (isRev && cIsEnableByamlInvertOrder)
         return bswap_32_ignore_last(mType);
 
     return (mType >> 8);
@@ -13,7 +13,7 @@ void ByamlData::set(const ByamlHashPair* hash_pair, bool isRev) {
 
 void ByamlData::set(u8 type, u32 value, bool isRev) {
     mType = (ByamlDataType)type;
-    mValue = isRev ? bswap_32(value) : value;
+    mValue = isRev && cIsEnableByamlInvertOrder ? bswap_32(value) : value;
 }
 
 ByamlDataType ByamlData::getType() const {
@@ -25,7 +25,7 @@ u32 ByamlData::getValue() const {
 }
 
 s32 ByamlHashPair::getKey(bool isRev) const {
-    return isRev ? bswap_24(mData) : mData & 0xFFFFFF;
+    return isRev && cIsEnableByamlInvertOrder ? bswap_24(mData) : mData & 0xFFFFFF;
 }
 
 ByamlDataType ByamlHashPair::getType() const {
@@ -33,7 +33,7 @@ ByamlDataType ByamlHashPair::getType() const {
 }
 
 s32 ByamlHashPair::getValue(bool isRev) const {
-    return isRev ? bswap_32(mValue) : mValue;
+    return isRev && cIsEnableByamlInvertOrder ? bswap_32(mValue) : mValue;
 }
 
 ByamlHashIter::ByamlHashIter(const u8* data, bool isRev_) : mData(data), mIsRev(isRev_) {}
@@ -133,7 +133,7 @@ u32 ByamlHashIter::getSize() const {
     if (!mData)
         return 0;
     u32 val = *reinterpret_cast<const u32*>(mData);
-    return mIsRev ? bswap_24(val >> 8) : val >> 8;
+    return mIsRev && cIsEnableByamlInvertOrder ? bswap_24(val >> 8) : val >> 8;
 }
 
 ByamlArrayIter::ByamlArrayIter(const u8* data, bool isRev_) : mData(data), mIsRev(isRev_) {}
@@ -161,7 +161,7 @@ const u8* ByamlArrayIter::getOffsetData(u32 off) const {
 
 u32 ByamlArrayIter::getSize() const {
     u32 val = *reinterpret_cast<const u32*>(mData);
-    return mIsRev ? bswap_24(val >> 8) : val >> 8;
+    return mIsRev && cIsEnableByamlInvertOrder ? bswap_24(val >> 8) : val >> 8;
 }
 
 const u8* ByamlArrayIter::getTypeTable() const {
@@ -5,6 +5,15 @@
 namespace al {
 class ByamlHashPair;
 
+// Builds with AL_BYAML_HOST_ORDER_ONLY only accept BYAML in host byte order, which lets every
+// byte swap fold away. Inverted files have to go through normalizeByamlByteOrder first, which
+// Resource does for every BYAML of the archives it loads.
+#ifdef AL_BYAML_HOST_ORDER_ONLY
+constexpr bool cIsEnableByamlInvertOrder = false;
+#else
+constexpr bool cIsEnableByamlInvertOrder = true;
+#endif
+
 enum ByamlDataType : const u8 {
     TYPE_INVALID = 0,
     TYPE_STRING = 0xA0,
@@ -1,9 +1,16 @@
 #include "Library/Yaml/ByamlHeader.h"
 
 #include <byteswap.h>
+#include <cstring>
+#include <heap/seadHeap.h>
 #include <prim/seadEndian.h>
 #include <stream/seadStream.h>
 
+#ifdef __aarch64__
+#include <arm_neon.h>
+#endif
+
+#include "Library/Yaml/ByamlContainerHeader.h"
 #include "Library/Yaml/ByamlData.h"
 
 #define BYAML_LE_TAG 'YB'
@@ -14,11 +21,11 @@ u16 ByamlHeader::getTag() const {
 }
 
 bool ByamlHeader::isInvertOrder() const {
-    return mTag == BYAML_LE_TAG;
+    return cIsEnableByamlInvertOrder && mTag == BYAML_LE_TAG;
 }
 
 u16 ByamlHeader::getVersion() const {
-    if ((_0 & 0xFFFF) == BYAML_LE_TAG)  // isInvertOrder()
+    if (cIsEnableByamlInvertOrder && (_0 & 0xFFFF) == BYAML_LE_TAG)  // isInvertOrder()
         return bswap_16(_0 >> 16);
     return _0 >> 16;
 }
@@ -42,7 +49,9 @@ ByamlStringTableIter::ByamlStringTableIter(const u8* data, bool isRev)
 
 s32 ByamlStringTableIter::getSize() const {
     u32 type_and_size = *reinterpret_cast<const u32*>(mData);
-    return mIsRev ? bswap_24(type_and_size >> 8) : type_and_size >> 8;
+    if (mIsRev && cIsEnableByamlInvertOrder)
+        return bswap_24(type_and_size >> 8);
+    return type_and_size >> 8;
 }
 
 const u32* ByamlStringTableIter::getAddressTable() const {
@@ -52,7 +61,7 @@ const u32* ByamlStringTableIter::getAddressTable() const {
 }
 
 u32 ByamlStringTableIter::getStringAddress(s32 idx) const {
-    if (mIsRev)
+    if (mIsRev && cIsEnableByamlInvertOrder)
         return bswap_32(getAddressTable()[idx]);
 
     return getAddressTable()[idx];
@@ -61,7 +70,7 @@ u32 ByamlStringTableIter::getStringAddress(s32 idx) const {
 // NON_MATCHING: regalloc
 u32 ByamlStringTableIter::getEndAddress() const {
     u32 val = getAddressTable()[getSize()];
-    return mIsRev ? bswap_32(val) : val;
+    return mIsRev && cIsEnableByamlInvertOrder ? bswap_32(val) : val;
 }
 
 const char* ByamlStringTableIter::getString(s32 index) const {
@@ -149,7 +158,7 @@ al::ByamlStringTableIter getStringTable(const u8* data) {
 
 u64 getData64Bit(const u8* data, u32 off, bool isRev) {
     u64 val = *reinterpret_cast<const u64*>(&data[off]);
-    return isRev ? bswap_32_64(val) : val;
+    return isRev && al::cIsEnableByamlInvertOrder ? bswap_32_64(val) : val;
 }
 
 void writeU24(sead::WriteStream* stream, s32 val) {
@@ -164,6 +173,301 @@ void writeU24(sead::WriteStream* stream, s32 val) {
     }
 }
 
+namespace {
+// Deepest container nesting accepted. Real files nest far less, this only stops malformed ones
+// from exhausting the stack.
+constexpr s32 cMaxSwapDepth = 128;
+
+// Bitmaps with one bit per 4-byte word of the file, see SwapContext.
+enum SwapBitmap {
+    SwapBitmap_Claimed,
+    SwapBitmap_Container,
+    SwapBitmap_BigData,
+    SwapBitmap_Open,  // containers between entry and exit, reaching one again is a cycle
+    SwapBitmap_Num
+};
+
+// State of one pass over the file. The first pass only checks the file, the second one swaps it
+// and takes exactly the same path, as every word is read before it is swapped and no word belongs
+// to two nodes. Each string table, container and 64-bit value claims its words the first time it
+// is reached. Containers and 64-bit values can be referenced by several parents and are skipped
+// when they are reached again at the same offset with the same type, any other overlap and any
+// container that contains itself is rejected.
+struct SwapContext {
+    u8* data;
+    u32 dataSize;
+    bool isRev;
+    bool isSwap;
+    s32 hashKeyNum;
+    s32 stringNum;
+    u32* bitmaps[SwapBitmap_Num];
+};
+
+u32 readU32(const u8* data, bool isRev) {
+    u32 val = *reinterpret_cast<const u32*>(data);
+    return isRev ? bswap_32(val) : val;
+}
+
+s32 readContainerSize(const u8* node, bool isRev) {
+    u32 type_and_size = *reinterpret_cast<const u32*>(node);
+    return isRev ? bswap_24(type_and_size >> 8) : type_and_size >> 8;
+}
+
+void swapBytes(u8* data, s32 a, s32 b) {
+    u8 tmp = data[a];
+    data[a] = data[b];
+    data[b] = tmp;
+}
+
+void swapU32(u8* data) {
+    u32* val = reinterpret_cast<u32*>(data);
+    *val = bswap_32(*val);
+}
+
+// 64-bit values are only 4-byte aligned in the file.
+void swapU64(u8* data) {
+    u64 val;
+    memcpy(&val, data, sizeof(u64));
+    val = bswap_32_64(val);
+    memcpy(data, &val, sizeof(u64));
+}
+
+bool isContainerType(u8 type) {
+    return type == al::ByamlDataType::TYPE_ARRAY || type == al::ByamlDataType::TYPE_HASH;
+}
+
+bool isBigDataType(u8 type) {
+    return type == al::ByamlDataType::TYPE_LONG || type == al::ByamlDataType::TYPE_ULONG ||
+           type == al::ByamlDataType::TYPE_DOUBLE;
+}
+
+bool isInside(const SwapContext& ctx, u32 offset, u64 size) {
+    return offset >= 16 && (offset & 3) == 0 && offset + size <= ctx.dataSize;
+}
+
+bool testBit(const SwapContext& ctx, SwapBitmap bitmap, u32 offset) {
+    u32 word = offset >> 2;
+    return ctx.bitmaps[bitmap][word >> 5] & (1u << (word & 31));
+}
+
+void setBit(SwapContext* ctx, SwapBitmap bitmap, u32 offset) {
+    u32 word = offset >> 2;
+    ctx->bitmaps[bitmap][word >> 5] |= 1u << (word & 31);
+}
+
+void clearBit(SwapContext* ctx, SwapBitmap bitmap, u32 offset) {
+    u32 word = offset >> 2;
+    ctx->bitmaps[bitmap][word >> 5] &= ~(1u << (word & 31));
+}
+
+// Fails if any word of [offset, offset + size) already belongs to another part of the file.
+bool claimRange(SwapContext* ctx, u32 offset, u64 size) {
+    if (!isInside(*ctx, offset, size))
+        return false;
+
+    u32 end = offset + size;
+    for (u32 i = offset; i < end; i += 4) {
+        if (testBit(*ctx, SwapBitmap_Claimed, i))
+            return false;
+        setBit(ctx, SwapBitmap_Claimed, i);
+    }
+    return true;
+}
+
+// Returns the entry count, or -1 if the table is malformed.
+s32 swapStringTable(SwapContext* ctx, u32 offset) {
+    if (!isInside(*ctx, offset, 8))
+        return -1;
+
+    u8* table = &ctx->data[offset];
+    s32 size = readContainerSize(table, ctx->isRev);
+    if (table[0] != al::ByamlDataType::TYPE_STRING_TABLE ||
+        !isInside(*ctx, offset, 4 + (size + 1) * 4ull))
+        return -1;
+
+    // verifiByamlStringTable reads in front of every address before it checks their order
+    u32 prev_address = 0;
+    for (s32 i = 0; i <= size; i++) {
+        u32 address = readU32(&table[4 + i * 4], ctx->isRev);
+        if (address <= prev_address || address > ctx->dataSize - offset)
+            return -1;
+        prev_address = address;
+    }
+
+    // the strings are not swapped, but must not be overwritten by anything else either
+    if (!claimRange(ctx, offset, (prev_address + 3) & ~3u))
+        return -1;
+
+    if (!ctx->isSwap)
+        return alByamlLocalUtil::verifiByamlStringTable(table, ctx->isRev) ? size : -1;
+
+    swapBytes(table, 1, 3);
+    for (s32 i = 0; i <= size; i++)
+        swapU32(&table[4 + i * 4]);
+    return size;
+}
+
+bool swapContainer(SwapContext* ctx, u32 offset, s32 depth);
+
+bool swapBigData(SwapContext* ctx, u32 offset) {
+    if (!isInside(*ctx, offset, 8))
+        return false;
+    if (testBit(*ctx, SwapBitmap_BigData, offset))
+        return true;
+    if (!claimRange(ctx, offset, 8))
+        return false;
+
+    setBit(ctx, SwapBitmap_BigData, offset);
+    if (ctx->isSwap)
+        swapU64(&ctx->data[offset]);
+    return true;
+}
+
+bool swapValue(SwapContext* ctx, u8 type, u8* value, s32 depth) {
+    u32 val = readU32(value, ctx->isRev);
+    if (ctx->isSwap)
+        swapU32(value);
+
+    if (isContainerType(type))
+        return swapContainer(ctx, val, depth + 1);
+    if (isBigDataType(type))
+        return swapBigData(ctx, val);
+    if (type == al::ByamlDataType::TYPE_STRING)
+        return val < (u32)ctx->stringNum;
+    return true;
+}
+
+bool swapContainer(SwapContext* ctx, u32 offset, s32 depth) {
+    if (depth > cMaxSwapDepth || !isInside(*ctx, offset, 4))
+        return false;
+    if (testBit(*ctx, SwapBitmap_Container, offset))
+        return !testBit(*ctx, SwapBitmap_Open, offset);
+
+    u8* node = &ctx->data[offset];
+    if (!isContainerType(node[0]))
+        return false;
+
+    s32 size = readContainerSize(node, ctx->isRev);
+    bool is_hash = node[0] == al::ByamlDataType::TYPE_HASH;
+    u32 data_table_offset = is_hash ? 4 : (size + 7) & ~3;
+    if (!claimRange(ctx, offset, data_table_offset + size * (is_hash ? 8ull : 4ull)))
+        return false;
+
+    setBit(ctx, SwapBitmap_Container, offset);
+    setBit(ctx, SwapBitmap_Open, offset);
+    if (ctx->isSwap)
+        swapBytes(node, 1, 3);
+
+    if (is_hash) {
+        for (s32 i = 0; i < size; i++) {
+            u8* pair = &node[4 + i * 8];
+            u32 key_and_type = *reinterpret_cast<const u32*>(pair);
+            u32 key_index = ctx->isRev ? bswap_24(key_and_type & 0xFFFFFF) : key_and_type & 0xFFFFFF;
+            if (key_index >= (u32)ctx->hashKeyNum)
+                return false;
+            if (ctx->isSwap)
+                swapBytes(pair, 0, 2);
+            if (!swapValue(ctx, pair[3], &pair[4], depth))
+                return false;
+        }
+    } else {
+        u8* data_table = &node[data_table_offset];
+        for (s32 i = 0; i < size; i++)
+            if (!swapValue(ctx, node[4 + i], &data_table[i * 4], depth))
+                return false;
+    }
+
+    clearBit(ctx, SwapBitmap_Open, offset);
+    return true;
+}
+
+bool swapByamlPass(SwapContext* ctx) {
+    u8* data = ctx->data;
+    u32 hash_key_table_offset = readU32(&data[4], ctx->isRev);
+    u32 string_table_offset = readU32(&data[8], ctx->isRev);
+    u32 root_offset = readU32(&data[12], ctx->isRev);
+
+    if (ctx->isSwap) {
+        swapBytes(data, 0, 1);
+        swapBytes(data, 2, 3);
+        for (s32 i = 1; i < 4; i++)
+            swapU32(&data[i * 4]);
+    }
+
+    ctx->hashKeyNum = 0;
+    if (hash_key_table_offset != 0) {
+        ctx->hashKeyNum = swapStringTable(ctx, hash_key_table_offset);
+        if (ctx->hashKeyNum < 0)
+            return false;
+    }
+    ctx->stringNum = 0;
+    if (string_table_offset != 0) {
+        ctx->stringNum = swapStringTable(ctx, string_table_offset);
+        if (ctx->stringNum < 0)
+            return false;
+    }
+    return root_offset == 0 || swapContainer(ctx, root_offset, 0);
+}
+
+// Checks every offset, count and index of the file against dataSize and the string tables, and
+// swaps it afterwards if isSwap is set, so malformed data is rejected before the first byte is
+// written. workHeap holds the bitmaps for the duration of the call.
+bool checkAndSwapByaml(u8* data, u32 dataSize, sead::Heap* workHeap, bool isSwap) {
+    if (dataSize < 16)
+        return false;
+
+    u16 tag = *reinterpret_cast<const u16*>(data);
+    if (tag != BYAML_LE_TAG && tag != 'BY')
+        return false;
+
+    u32 bitmap_word_num = ((dataSize >> 2) + 31) / 32;
+    u32 bitmaps_size = bitmap_word_num * SwapBitmap_Num * sizeof(u32);
+    u32* bitmaps = static_cast<u32*>(workHeap->tryAlloc(bitmaps_size, 4));
+    if (!bitmaps)
+        return false;
+
+    SwapContext ctx = {data, dataSize, tag == BYAML_LE_TAG, false, 0, 0, {}};
+    for (s32 i = 0; i < SwapBitmap_Num; i++)
+        ctx.bitmaps[i] = &bitmaps[i * bitmap_word_num];
+
+    memset(bitmaps, 0, bitmaps_size);
+    bool is_valid = swapByamlPass(&ctx);
+    if (is_valid && isSwap) {
+        ctx.isSwap = true;
+        memset(bitmaps, 0, bitmaps_size);
+        swapByamlPass(&ctx);
+    }
+
+    workHeap->free(bitmaps);
+    return is_valid;
+}
+}  // namespace
+
+// Swaps every header field, string table offset, container and 64-bit value of a BYAML between
+// the two byte orders in place.
+bool invertByamlByteOrder(u8* data, u32 dataSize, sead::Heap* workHeap) {
+    return checkAndSwapByaml(data, dataSize, workHeap, true);
+}
+
+// Converts a BYAML stored in the inverted byte order into host order in place, so that every
+// later access can skip the byte swaps. Data already in host order is only checked. Either way the
+// file is bounds-checked against dataSize before verifiByaml, which trusts the offsets it reads.
+bool normalizeByamlByteOrder(u8* data, u32 dataSize, sead::Heap* workHeap) {
+    if (dataSize < 16)
+        return false;
+
+    bool is_inverted = *reinterpret_cast<const u16*>(data) == BYAML_LE_TAG;
+    if (!checkAndSwapByaml(data, dataSize, workHeap, is_inverted))
+        return false;
+    if (verifiByaml(data))
+        return true;
+
+    // rejected data is left in the byte order it was passed in
+    if (is_inverted)
+        checkAndSwapByaml(data, dataSize, workHeap, true);
+    return false;
+}
+
 // NON_MATCHING: inlined verifiHeader, splitted loads for unswappedAfterOffset and diff in final
 // logic
 bool verifiByaml(const u8* data) {
@@ -268,4 +572,101 @@ bool verifiByamlStringTable(const u8* data, bool isRev) {
     return true;
 }
 
+namespace {
+s32 readOffset(const s32* table, s32 index, bool isRev) {
+    return isRev ? bswap_32(table[index]) : table[index];
+}
+
+bool isOffsetTableAscending(const s32* table, s32 size, bool isRev) {
+    s32 i = 0;
+#ifdef __aarch64__
+    for (; i + 4 <= size; i += 4) {
+        uint8x16_t current = vld1q_u8(reinterpret_cast<const u8*>(&table[i]));
+        uint8x16_t next = vld1q_u8(reinterpret_cast<const u8*>(&table[i + 1]));
+        if (isRev) {
+            current = vrev32q_u8(current);
+            next = vrev32q_u8(next);
+        }
+        uint32x4_t is_less = vcltq_s32(vreinterpretq_s32_u8(current), vreinterpretq_s32_u8(next));
+        if (vminvq_u32(is_less) == 0)
+            return false;
+    }
+#endif
+    for (; i < size; i++)
+        if (readOffset(table, i, isRev) >= readOffset(table, i + 1, isRev))
+            return false;
+    return true;
+}
+}  // namespace
+
+// Same result as verifiByamlStringTable. The offset table is checked first, four offsets at a
+// time where NEON is available, so the string checks only run on offsets known to be ordered.
+bool verifiByamlStringTableFast(const u8* data, bool isRev) {
+    const s32* address_table = reinterpret_cast<const s32*>(data + 4);
+
+    u32 type_and_size = *reinterpret_cast<const u32*>(data);
+    if ((type_and_size & 0xff) != al::ByamlDataType::TYPE_STRING_TABLE)
+        return false;
+    s32 size = isRev ? bswap_24(type_and_size >> 8) : type_and_size >> 8;
+    if (size < 1)
+        return false;
+
+    if (readOffset(address_table, 0, isRev) != 4 * size + 8)
+        return false;
+    if (!isOffsetTableAscending(address_table, size, isRev))
+        return false;
+
+    const char* prev = nullptr;
+    for (s32 i = 1; i <= size; i++) {
+        s32 end = readOffset(address_table, i, isRev);
+        if (data[end - 1])
+            return false;
+
+        s32 start = readOffset(address_table, i - 1, isRev);
+        const char* string = reinterpret_cast<const char*>(&data[start]);
+        if (prev && strcmp(prev, string) > 0)
+            return false;
+        prev = string;
+    }
+    return true;
+}
+
+// Same result as verifiByaml, using verifiByamlStringTableFast for both string tables.
+bool verifiByamlFast(const u8* data) {
+    if (!verifiByamlHeader(data))
+        return false;
+
+    const al::ByamlHeader* header = reinterpret_cast<const al::ByamlHeader*>(data);
+    bool isRev = header->isInvertOrder();
+    u32 hashOffset = header->getHashKeyTableOffset();
+    u32 stringOffset = header->getStringTableOffset();
+    u32 rootOffset = header->getDataOffset();
+
+    s32 afterHashOffset = 0;
+    if (hashOffset) {
+        const u8* hashData = &data[hashOffset];
+        if (!verifiByamlStringTableFast(hashData, isRev))
+            return false;
+        const s32* address_table = reinterpret_cast<const s32*>(hashData + 4);
+        afterHashOffset = readOffset(address_table, getHashKeyTable(data).getSize(), isRev);
+    }
+
+    s32 afterStringOffset = 0;
+    if (stringOffset) {
+        const u8* stringData = &data[stringOffset];
+        if (!verifiByamlStringTableFast(stringData, isRev))
+            return false;
+        const s32* address_table = reinterpret_cast<const s32*>(stringData + 4);
+        afterStringOffset = readOffset(address_table, getStringTable(data).getSize(), isRev);
+    }
+
+    if ((hashOffset || stringOffset) && !rootOffset)
+        return false;
+    if (hashOffset && stringOffset && (u32)afterHashOffset > stringOffset)
+        return false;
+    if (hashOffset && rootOffset && (u32)afterHashOffset > rootOffset)
+        return false;
+    return !stringOffset || !rootOffset || (u32)afterStringOffset <= rootOffset;
+}
+
 }  // namespace alByamlLocalUtil
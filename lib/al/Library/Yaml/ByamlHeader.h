@@ -3,6 +3,10 @@
 #include <basis/seadTypes.h>
 #include <stream/seadStream.h>
 
+namespace sead {
+class Heap;
+}  // namespace sead
+
 namespace al {
 class ByamlHeader {
 public:
@@ -54,5 +58,9 @@ void writeU24(sead::WriteStream* stream, s32 val);
 bool verifiByaml(const u8* data);
 bool verifiByamlHeader(const u8* data);
 bool verifiByamlStringTable(const u8* data, bool isRev);
+bool invertByamlByteOrder(u8* data, u32 dataSize, sead::Heap* workHeap);
+bool normalizeByamlByteOrder(u8* data, u32 dataSize, sead::Heap* workHeap);
+bool verifiByamlFast(const u8* data);
+bool verifiByamlStringTableFast(const u8* data, bool isRev);
 
 }  // namespace alByamlLocalUtil
@@ -7,10 +7,11 @@
 namespace al {
 ByamlIter::ByamlIter() : mData(nullptr), mRootNode(nullptr) {}
 
+// NON_MATCHING: verifiByamlFast instead of verifiByaml
 ByamlIter::ByamlIter(const u8* data) : mData(data), mRootNode(nullptr) {
     if (!data)
         return;
-    if (!alByamlLocalUtil::verifiByaml(data)) {
+    if (!alByamlLocalUtil::verifiByamlFast(data)) {
         mData = nullptr;
         mRootNode = nullptr;
         return;
@@ -509,4 +510,95 @@ bool ByamlIter::isEqualData(const ByamlIter& other) const {
     return mData == other.mData && mRootNode == other.mRootNode;
 }
 
+// Lookups by hash key table index. The index is resolved once per file with getKeyIndex, after
+// which the binary search only compares integer keys instead of strings.
+bool ByamlIter::tryGetIterByKeyIndex(ByamlIter* iter, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index) || !tryConvertIter(iter, &data)) {
+        *iter = {};
+        return false;
+    }
+    return true;
+}
+
+bool ByamlIter::tryGetStringByKeyIndex(const char** value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertString(value, &data);
+}
+
+bool ByamlIter::tryGetBoolByKeyIndex(bool* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertBool(value, &data);
+}
+
+bool ByamlIter::tryGetIntByKeyIndex(s32* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertInt(value, &data);
+}
+
+bool ByamlIter::tryGetUIntByKeyIndex(u32* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertUInt(value, &data);
+}
+
+bool ByamlIter::tryGetFloatByKeyIndex(f32* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertFloat(value, &data);
+}
+
+bool ByamlIter::tryGetInt64ByKeyIndex(s64* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertInt64(value, &data);
+}
+
+bool ByamlIter::tryGetUInt64ByKeyIndex(u64* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertUInt64(value, &data);
+}
+
+bool ByamlIter::tryGetDoubleByKeyIndex(f64* value, s32 key_index) const {
+    ByamlData data;
+    if (!getByamlDataByKeyIndex(&data, key_index))
+        return false;
+
+    if (data.getType() == ByamlDataType::TYPE_NULL)
+        return false;
+    return tryConvertDouble(value, &data);
+}
+
 }  // namespace al
@@ -56,6 +56,15 @@ public:
     bool tryGetUInt64ByIndex(u64* val, s32 index) const;
     bool tryGetDoubleByIndex(f64* val, s32 index) const;
     bool tryConvertIter(ByamlIter* iter, const ByamlData* data) const;
+    bool tryGetIterByKeyIndex(ByamlIter* iter, s32 key_index) const;
+    bool tryGetStringByKeyIndex(const char** string, s32 key_index) const;
+    bool tryGetBoolByKeyIndex(bool* val, s32 key_index) const;
+    bool tryGetIntByKeyIndex(s32* val, s32 key_index) const;
+    bool tryGetUIntByKeyIndex(u32* val, s32 key_index) const;
+    bool tryGetFloatByKeyIndex(f32* val, s32 key_index) const;
+    bool tryGetInt64ByKeyIndex(s64* val, s32 key_index) const;
+    bool tryGetUInt64ByKeyIndex(u64* val, s32 key_index) const;
+    bool tryGetDoubleByKeyIndex(f64* val, s32 key_index) const;
     bool isEqualData(const ByamlIter& other) const;
 
     const ByamlHeader* getHeader() const { return mHeader; }
@@ -0,0 +1,40 @@
+#include "Library/Yaml/ByamlKeyHandle.h"
+
+#include <cstring>
+
+#include "Library/Yaml/ByamlHeader.h"
+#include "Library/Yaml/ByamlIter.h"
+
+namespace al {
+ByamlKeyHandle::ByamlKeyHandle() : mKey(nullptr) {}
+
+ByamlKeyHandle::ByamlKeyHandle(const char* key) : mKey(key) {}
+
+ByamlKeyHandle::ByamlKeyHandle(const char* key, const ByamlIter& iter) : mKey(key) {
+    resolve(iter);
+}
+
+void ByamlKeyHandle::resolve(const ByamlIter& iter) {
+    mKeyIndex = iter.isValid() ? iter.getKeyIndex(mKey) : -1;
+}
+
+// Hash key tables are sorted and hold every key once, so a table holding the key at the resolved
+// index gives the same index as resolving the key again.
+bool ByamlKeyHandle::isResolved(const ByamlIter& iter) const {
+    if (mKeyIndex < 0 || !iter.isValid())
+        return false;
+
+    ByamlStringTableIter hash = alByamlLocalUtil::getHashKeyTable(
+        reinterpret_cast<const u8*>(iter.getHeader()));
+    return hash.isValidate() && mKeyIndex < hash.getSize() &&
+           strcmp(hash.getString(mKeyIndex), mKey) == 0;
+}
+
+s32 ByamlKeyHandle::getKeyIndex(const ByamlIter& iter) const {
+    if (isResolved(iter))
+        return mKeyIndex;
+    if (!iter.isValid())
+        return -1;
+    return iter.getKeyIndex(mKey);
+}
+}  // namespace al
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+namespace al {
+class ByamlIter;
+
+// Key string bound to its index in the hash key table of one BYAML file. Resolving once and
+// looking up by index replaces the strcmp binary search done by the tryGet*ByKey functions.
+// The index is checked against the key table of the file looked up in, so a handle is never used
+// with the index of another file, even one loaded at the same address. Lookups into a file that
+// does not hold the key at that index fall back to resolving the key string.
+class ByamlKeyHandle {
+public:
+    ByamlKeyHandle();
+    ByamlKeyHandle(const char* key);
+    ByamlKeyHandle(const char* key, const ByamlIter& iter);
+
+    void resolve(const ByamlIter& iter);
+    bool isResolved(const ByamlIter& iter) const;
+    s32 getKeyIndex(const ByamlIter& iter) const;
+
+    const char* getKey() const { return mKey; }
+
+private:
+    const char* mKey;
+    s32 mKeyIndex = -1;
+};
+}  // namespace al
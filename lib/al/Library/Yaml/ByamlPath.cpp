@@ -0,0 +1,170 @@
+#include "Library/Yaml/ByamlPath.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "Library/Yaml/ByamlData.h"
+#include "Library/Yaml/ByamlIter.h"
+#include "Library/Yaml/ByamlKeyHandle.h"
+
+namespace al {
+namespace {
+constexpr s32 cKeySegment = -1;
+
+// Array indices only apply to arrays, getByamlDataByIndex would also take the n-th pair of a hash.
+bool tryGetIndexData(ByamlData* data, const ByamlIter& iter, s32 index) {
+    if (!iter.isTypeArray() || index >= iter.getSize())
+        return false;
+    return iter.getByamlDataByIndex(data, index);
+}
+
+bool isDigit(char c) {
+    return c >= '0' && c <= '9';
+}
+}  // namespace
+
+ByamlPath::ByamlPath(const char* path) : mPath(path) {
+    parse();
+}
+
+ByamlPath::ByamlPath(const char* path, const ByamlIter& iter) : mPath(path) {
+    parse();
+    compile(iter);
+}
+
+// Keys are copied into mKeyBuffer with the separators replaced by terminators, so that the key
+// handles can point into it.
+void ByamlPath::parse() {
+    s32 path_length = strlen(mPath);
+    if (path_length >= cPathLengthMax)
+        return;
+    memcpy(mKeyBuffer, mPath, path_length + 1);
+
+    char* segment = mKeyBuffer;
+    while (true) {
+        char* end = strchr(segment, '/');
+        s32 length = end ? end - segment : strlen(segment);
+        if (length == 0 || mSegmentNum >= cSegmentNumMax)
+            return;
+        if (end)
+            *end = '\0';
+
+        if (segment[0] == '[') {
+            if (!isDigit(segment[1]))
+                return;
+            char* index_end = nullptr;
+            long index = strtol(segment + 1, &index_end, 10);
+            if (index > std::numeric_limits<s32>::max() || index_end != segment + length - 1 ||
+                *index_end != ']')
+                return;
+            mIndices[mSegmentNum] = index;
+        } else {
+            mIndices[mSegmentNum] = cKeySegment;
+            mKeys[mSegmentNum] = ByamlKeyHandle(segment);
+        }
+        mSegmentNum++;
+
+        if (!end)
+            break;
+        segment = end + 1;
+    }
+    mIsValid = true;
+}
+
+void ByamlPath::compile(const ByamlIter& iter) {
+    for (s32 i = 0; i < mSegmentNum; i++)
+        if (mIndices[i] == cKeySegment)
+            mKeys[i].resolve(iter);
+}
+
+bool ByamlPath::isCompiled(const ByamlIter& iter) const {
+    if (!mIsValid)
+        return false;
+    for (s32 i = 0; i < mSegmentNum; i++)
+        if (mIndices[i] == cKeySegment && !mKeys[i].isResolved(iter))
+            return false;
+    return true;
+}
+
+bool ByamlPath::tryGetData(ByamlData* data, const ByamlIter& iter) const {
+    if (!mIsValid || !iter.isValid())
+        return false;
+
+    ByamlIter current = iter;
+    for (s32 i = 0; i < mSegmentNum; i++) {
+        if (mIndices[i] != cKeySegment) {
+            if (!tryGetIndexData(data, current, mIndices[i]))
+                return false;
+        } else {
+            s32 key_index = mKeys[i].getKeyIndex(current);
+            if (key_index < 0 || !current.getByamlDataByKeyIndex(data, key_index))
+                return false;
+        }
+        if (i != mSegmentNum - 1 && !current.tryConvertIter(&current, data))
+            return false;
+    }
+    return true;
+}
+
+bool ByamlPath::tryGetIter(ByamlIter* out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertIter(out, &data);
+}
+
+bool ByamlPath::tryGetString(const char** out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertString(out, &data);
+}
+
+bool ByamlPath::tryGetBool(bool* out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertBool(out, &data);
+}
+
+bool ByamlPath::tryGetInt(s32* out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertInt(out, &data);
+}
+
+bool ByamlPath::tryGetUInt(u32* out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertUInt(out, &data);
+}
+
+bool ByamlPath::tryGetFloat(f32* out, const ByamlIter& iter) const {
+    ByamlData data;
+    if (!tryGetData(&data, iter))
+        return false;
+    return iter.tryConvertFloat(out, &data);
+}
+
+// Descends to the container the path points to once, then reads every key in keys from it.
+// Leaves that are missing are left as TYPE_INVALID. Returns the number of leaves found.
+s32 ByamlPath::getLeafDataList(ByamlIter* subtree, ByamlData* dataList, const ByamlKeyHandle* keys,
+                               s32 keyNum, const ByamlIter& iter) const {
+    for (s32 i = 0; i < keyNum; i++)
+        dataList[i] = ByamlData();
+
+    if (!tryGetIter(subtree, iter))
+        return 0;
+
+    s32 found_num = 0;
+    for (s32 i = 0; i < keyNum; i++) {
+        s32 key_index = keys[i].getKeyIndex(*subtree);
+        if (key_index >= 0 && subtree->getByamlDataByKeyIndex(&dataList[i], key_index))
+            found_num++;
+    }
+    return found_num;
+}
+}  // namespace al
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#include "Library/Yaml/ByamlKeyHandle.h"
+
+namespace al {
+class ByamlIter;
+class ByamlData;
+
+// Path of hash keys and array indices such as "Objs/[3]/Translate/X". The path is split when it
+// is constructed, and compile resolves its keys into key indices for one BYAML file. On a file
+// holding the keys at those indices, evaluating the path only looks up indices. On any other file
+// the keys are looked up by string for that evaluation. Evaluating never changes the path, so a
+// compiled path can be shared between threads.
+class ByamlPath {
+public:
+    static constexpr s32 cSegmentNumMax = 16;
+    static constexpr s32 cPathLengthMax = 256;
+
+    explicit ByamlPath(const char* path);
+    ByamlPath(const char* path, const ByamlIter& iter);
+
+    void compile(const ByamlIter& iter);
+    bool isCompiled(const ByamlIter& iter) const;
+
+    bool tryGetData(ByamlData* data, const ByamlIter& iter) const;
+    bool tryGetIter(ByamlIter* out, const ByamlIter& iter) const;
+    bool tryGetString(const char** out, const ByamlIter& iter) const;
+    bool tryGetBool(bool* out, const ByamlIter& iter) const;
+    bool tryGetInt(s32* out, const ByamlIter& iter) const;
+    bool tryGetUInt(u32* out, const ByamlIter& iter) const;
+    bool tryGetFloat(f32* out, const ByamlIter& iter) const;
+    s32 getLeafDataList(ByamlIter* subtree, ByamlData* dataList, const ByamlKeyHandle* keys,
+                        s32 keyNum, const ByamlIter& iter) const;
+
+    const char* getPath() const { return mPath; }
+
+    bool isValid() const { return mIsValid; }
+
+    s32 getSegmentNum() const { return mSegmentNum; }
+
+private:
+    void parse();
+
+    // Array indices, or -1 for the segments that are hash keys.
+    s32 mIndices[cSegmentNumMax];
+    ByamlKeyHandle mKeys[cSegmentNumMax];
+    s32 mSegmentNum = 0;
+    const char* mPath;
+    bool mIsValid = false;
+    char mKeyBuffer[cPathLengthMax];
+};
+}  // namespace al
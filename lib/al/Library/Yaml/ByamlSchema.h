@@ -0,0 +1,114 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <cstring>
+
+#include "Library/Yaml/ByamlHeader.h"
+#include "Library/Yaml/ByamlIter.h"
+
+namespace al {
+
+enum class ByamlSchemaFieldType : u8 { S32, F32, Bool };
+
+// Binds a key of a BYAML hash to a member of T, along with the value the member takes when the
+// key is missing.
+template <typename T>
+struct ByamlSchemaField {
+    constexpr ByamlSchemaField(const char* key, s32 T::*member, s32 defaultValue)
+        : key(key), type(ByamlSchemaFieldType::S32), memberS32(member), defaultS32(defaultValue) {}
+
+    constexpr ByamlSchemaField(const char* key, f32 T::*member, f32 defaultValue)
+        : key(key), type(ByamlSchemaFieldType::F32), memberF32(member), defaultF32(defaultValue) {}
+
+    constexpr ByamlSchemaField(const char* key, bool T::*member, bool defaultValue)
+        : key(key), type(ByamlSchemaFieldType::Bool), memberBool(member),
+          defaultBool(defaultValue) {}
+
+    const char* key;
+    ByamlSchemaFieldType type;
+
+    union {
+        s32 T::*memberS32;
+        f32 T::*memberF32;
+        bool T::*memberBool;
+    };
+
+    union {
+        s32 defaultS32;
+        f32 defaultF32;
+        bool defaultBool;
+    };
+};
+
+// Same ordering as strcmp, which is the order of the BYAML hash key table.
+constexpr s32 compareByamlSchemaKey(const char* a, const char* b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return static_cast<u8>(*a) - static_cast<u8>(*b);
+}
+
+template <typename T, s32 N>
+constexpr bool isSortedByamlSchema(const ByamlSchemaField<T> (&fields)[N]) {
+    for (s32 i = 1; i < N; i++)
+        if (compareByamlSchemaKey(fields[i - 1].key, fields[i].key) >= 0)
+            return false;
+    return true;
+}
+
+// Resets every field to its default, then reads the keys present in the hash. The schema and the
+// hash key table are both sorted by string, so one walk over both finds the key index of every
+// field, after which each value is found by key index without comparing strings. A missing key
+// or a null value leaves the default, as tryGet*ByKey does.
+template <typename T, s32 N>
+void readByamlSchema(T* object, const ByamlIter& iter, const ByamlSchemaField<T> (&fields)[N]) {
+    for (s32 i = 0; i < N; i++) {
+        const ByamlSchemaField<T>& field = fields[i];
+        switch (field.type) {
+        case ByamlSchemaFieldType::S32:
+            object->*field.memberS32 = field.defaultS32;
+            break;
+        case ByamlSchemaFieldType::F32:
+            object->*field.memberF32 = field.defaultF32;
+            break;
+        case ByamlSchemaFieldType::Bool:
+            object->*field.memberBool = field.defaultBool;
+            break;
+        }
+    }
+
+    if (!iter.isTypeHash())
+        return;
+
+    ByamlStringTableIter key_table =
+        alByamlLocalUtil::getHashKeyTable(reinterpret_cast<const u8*>(iter.getHeader()));
+    if (!key_table.isValidate())
+        return;
+
+    s32 key_num = key_table.getSize();
+    s32 key_index = 0;
+    for (s32 i = 0; i < N && key_index < key_num; i++) {
+        const ByamlSchemaField<T>& field = fields[i];
+        s32 result = strcmp(key_table.getString(key_index), field.key);
+        while (result < 0 && ++key_index < key_num)
+            result = strcmp(key_table.getString(key_index), field.key);
+        if (result != 0)
+            continue;
+
+        switch (field.type) {
+        case ByamlSchemaFieldType::S32:
+            iter.tryGetIntByKeyIndex(&(object->*field.memberS32), key_index);
+            break;
+        case ByamlSchemaFieldType::F32:
+            iter.tryGetFloatByKeyIndex(&(object->*field.memberF32), key_index);
+            break;
+        case ByamlSchemaFieldType::Bool:
+            iter.tryGetBoolByKeyIndex(&(object->*field.memberBool), key_index);
+            break;
+        }
+        key_index++;
+    }
+}
+
+}  // namespace al
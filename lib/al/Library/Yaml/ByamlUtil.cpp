@@ -1,7 +1,10 @@
 #include "Library/Yaml/ByamlUtil.h"
 
 #include "Library/Yaml/ByamlData.h"
+#include "Library/Yaml/ByamlHeader.h"
 #include "Library/Yaml/ByamlIter.h"
+#include "Library/Yaml/ByamlKeyHandle.h"
+#include "Library/Yaml/ByamlPath.h"
 
 namespace al {
 bool tryGetByamlU8(u8* pOut, const ByamlIter& rIter, const char* pKey) {
@@ -283,6 +286,91 @@ bool tryGetByamlKeyAndIntByIndex(const char** key, s32* pOut, const ByamlIter& r
     return true;
 }
 
+bool tryGetByamlS32(s32* pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    return rIter.tryGetIntByKeyIndex(pOut, rKey.getKeyIndex(rIter));
+}
+
+bool tryGetByamlU32(u32* pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    s32 value = 0;
+    bool res = rIter.tryGetIntByKeyIndex(&value, rKey.getKeyIndex(rIter));
+    if (res)
+        *pOut = value;
+    return res;
+}
+
+bool tryGetByamlF32(f32* pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    f32 value = 0;
+    if (rIter.tryGetFloatByKeyIndex(&value, rKey.getKeyIndex(rIter))) {
+        *pOut = value;
+        return true;
+    }
+    return false;
+}
+
+bool tryGetByamlBool(bool* pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    return rIter.tryGetBoolByKeyIndex(pOut, rKey.getKeyIndex(rIter));
+}
+
+bool tryGetByamlString(const char** pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    return rIter.tryGetStringByKeyIndex(pOut, rKey.getKeyIndex(rIter));
+}
+
+bool tryGetByamlV2f(sead::Vector2f* pOut, const ByamlIter& sIter, const ByamlKeyHandle& rKey) {
+    ByamlIter rIter;
+    if (!sIter.tryGetIterByKeyIndex(&rIter, rKey.getKeyIndex(sIter)))
+        return false;
+
+    return tryGetByamlV2f(pOut, rIter);
+}
+
+bool tryGetByamlV3f(sead::Vector3f* pOut, const ByamlIter& sIter, const ByamlKeyHandle& rKey) {
+    ByamlIter rIter;
+    if (!sIter.tryGetIterByKeyIndex(&rIter, rKey.getKeyIndex(sIter)))
+        return false;
+
+    return tryGetByamlV3f(pOut, rIter);
+}
+
+bool tryGetByamlScale(sead::Vector3f* pOut, const ByamlIter& sIter, const ByamlKeyHandle& rKey) {
+    ByamlIter rIter;
+    if (!sIter.tryGetIterByKeyIndex(&rIter, rKey.getKeyIndex(sIter)))
+        return false;
+
+    return tryGetByamlScale(pOut, rIter);
+}
+
+bool tryGetByamlIterByKey(ByamlIter* pOut, const ByamlIter& rIter, const ByamlKeyHandle& rKey) {
+    return rIter.tryGetIterByKeyIndex(pOut, rKey.getKeyIndex(rIter));
+}
+
+bool tryGetByamlS32(s32* pOut, const ByamlIter& rIter, const ByamlPath& rPath) {
+    return rPath.tryGetInt(pOut, rIter);
+}
+
+bool tryGetByamlF32(f32* pOut, const ByamlIter& rIter, const ByamlPath& rPath) {
+    return rPath.tryGetFloat(pOut, rIter);
+}
+
+bool tryGetByamlBool(bool* pOut, const ByamlIter& rIter, const ByamlPath& rPath) {
+    return rPath.tryGetBool(pOut, rIter);
+}
+
+bool tryGetByamlString(const char** pOut, const ByamlIter& rIter, const ByamlPath& rPath) {
+    return rPath.tryGetString(pOut, rIter);
+}
+
+bool tryGetByamlV3f(sead::Vector3f* pOut, const ByamlIter& sIter, const ByamlPath& rPath) {
+    ByamlIter rIter;
+    if (!rPath.tryGetIter(&rIter, sIter))
+        return false;
+
+    return tryGetByamlV3f(pOut, rIter);
+}
+
+bool tryGetByamlIterByPath(ByamlIter* pOut, const ByamlIter& rIter, const ByamlPath& rPath) {
+    return rPath.tryGetIter(pOut, rIter);
+}
+
 const char* getByamlKeyString(const ByamlIter& rIter, const char* key) {
     return tryGetByamlKeyStringOrNULL(rIter, key);
 }
@@ -359,6 +447,10 @@ s32 getByamlIterDataNum(const ByamlIter& rIter) {
     return rIter.getSize();
 }
 
+bool normalizeByamlByteOrder(u8* data, u32 dataSize, sead::Heap* workHeap) {
+    return alByamlLocalUtil::normalizeByamlByteOrder(data, dataSize, workHeap);
+}
+
 void printByamlIter(const u8* data) {
     ByamlIter iter = {data};
     printByamlIter(iter);
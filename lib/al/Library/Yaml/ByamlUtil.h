@@ -8,10 +8,14 @@
 #include "Library/Yaml/ByamlIter.h"
 
 namespace sead {
+class Heap;
 class WriteStream;
 }
 
 namespace al {
+class ByamlKeyHandle;
+class ByamlPath;
+
 bool tryGetByamlU8(u8*, const ByamlIter&, const char*);
 bool tryGetByamlU16(u16*, const ByamlIter&, const char*);
 bool tryGetByamlS16(s16*, const ByamlIter&, const char*);
@@ -46,6 +50,23 @@ bool tryGetByamlKeyBoolOrFalse(const ByamlIter&, const char*);
 bool tryGetByamlIterByKey(ByamlIter*, const ByamlIter&, const char*);
 bool tryGetByamlKeyAndIntByIndex(const char**, s32*, const ByamlIter&, s32);
 
+bool tryGetByamlS32(s32*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlU32(u32*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlF32(f32*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlBool(bool*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlString(const char**, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlV2f(sead::Vector2f*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlV3f(sead::Vector3f*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlScale(sead::Vector3f*, const ByamlIter&, const ByamlKeyHandle&);
+bool tryGetByamlIterByKey(ByamlIter*, const ByamlIter&, const ByamlKeyHandle&);
+
+bool tryGetByamlS32(s32*, const ByamlIter&, const ByamlPath&);
+bool tryGetByamlF32(f32*, const ByamlIter&, const ByamlPath&);
+bool tryGetByamlBool(bool*, const ByamlIter&, const ByamlPath&);
+bool tryGetByamlString(const char**, const ByamlIter&, const ByamlPath&);
+bool tryGetByamlV3f(sead::Vector3f*, const ByamlIter&, const ByamlPath&);
+bool tryGetByamlIterByPath(ByamlIter*, const ByamlIter&, const ByamlPath&);
+
 const char* getByamlKeyString(const ByamlIter&, const char*);
 s32 getByamlKeyInt(const ByamlIter&, const char*);
 f32 getByamlKeyFloat(const ByamlIter&, const char*);
@@ -83,6 +104,7 @@ bool isTypeHashByIndex(const ByamlIter&, s32);
 bool isTypeHashByKey(const ByamlIter&, const char*);
 
 s32 getByamlIterDataNum(const ByamlIter&);
+bool normalizeByamlByteOrder(u8*, u32, sead::Heap*);
 
 struct PrintParams {
     s32 depth;
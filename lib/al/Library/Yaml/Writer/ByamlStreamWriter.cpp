@@ -0,0 +1,321 @@
+#include "Library/Yaml/Writer/ByamlStreamWriter.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <heap/seadHeapMgr.h>
+
+#include "Library/Yaml/ByamlData.h"
+#include "Library/Yaml/Writer/ByamlWriterStringTable.h"
+
+namespace al {
+
+ByamlStreamWriter::ByamlStreamWriter(sead::Heap* heap, u8* buffer, u32 bufferSize)
+    : mHeap(heap), mBuffer(buffer), mBufferSize(bufferSize & ~(alignof(Entry) - 1)) {
+    sead::ScopedCurrentHeapSetter setter{mHeap};
+    mEntryTable = reinterpret_cast<Entry*>(mBuffer + mBufferSize);
+    mKeyTable = new ByamlWriterStringTable();
+    mStringTable = new ByamlWriterStringTable();
+    mContainerStack = new Container[mContainerStackSize];
+}
+
+ByamlStreamWriter::~ByamlStreamWriter() {
+    delete mKeyTable;
+    delete mStringTable;
+    delete[] mContainerStack;
+}
+
+bool ByamlStreamWriter::tryReserve(u32 size) {
+    if (mIsOverflow)
+        return false;
+
+    u32 entry_low = mBufferSize - mEntryNum * sizeof(Entry);
+    if (mWriteSize + mStringTableSize + size > entry_low) {
+        mIsOverflow = true;
+        return false;
+    }
+    return true;
+}
+
+void ByamlStreamWriter::addEntry(const char* key, u8 type, u32 value) {
+    if (mCurrentContainerIndex < 0 || mIsRootPopped ||
+        mContainerStack[mCurrentContainerIndex].isHash != (key != nullptr)) {
+        mIsError = true;
+        return;
+    }
+    if (key && !(key = tryAddString(mKeyTable, key)))
+        return;
+    if (!tryReserve(sizeof(Entry)))
+        return;
+
+    Entry* entry = getEntry(mEntryNum);
+    entry->key = key;
+    entry->value = value;
+    entry->type = type;
+    mEntryNum++;
+}
+
+u32 ByamlStreamWriter::addBigData(u64 value) {
+    if (!tryReserve(sizeof(u64)))
+        return 0;
+
+    u32 offset = mWriteSize;
+    memcpy(&mBuffer[offset], &value, sizeof(u64));
+    mWriteSize += sizeof(u64);
+    return offset;
+}
+
+u32 ByamlStreamWriter::addStringData(const char* value) {
+    const char* string = tryAddString(mStringTable, value);
+    return string ? mStringTable->calcId(string) : 0;
+}
+
+// Returns nullptr if the string table would no longer fit into the buffer.
+const char* ByamlStreamWriter::tryAddString(ByamlWriterStringTable* table, const char* string) {
+    if (table->calcId(string) < 0) {
+        // a new string adds its address, its content and up to 3 bytes of padding, and the first
+        // one also the table header
+        u32 size = 4 + strlen(string) + 1 + 3 + (table->isEmpty() ? 8 : 0);
+        if (!tryReserve(size))
+            return nullptr;
+    }
+
+    sead::ScopedCurrentHeapSetter setter{mHeap};
+    const char* result = table->tryAdd(string);
+    mStringTableSize = mKeyTable->calcPackSize() + mStringTable->calcPackSize();
+    return result;
+}
+
+void ByamlStreamWriter::addBool(bool value) {
+    addEntry(nullptr, ByamlDataType::TYPE_BOOL, value);
+}
+
+void ByamlStreamWriter::addInt(s32 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_INT, value);
+}
+
+void ByamlStreamWriter::addUInt(u32 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_UINT, value);
+}
+
+void ByamlStreamWriter::addFloat(f32 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_FLOAT, *reinterpret_cast<const u32*>(&value));
+}
+
+void ByamlStreamWriter::addInt64(s64 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_LONG, addBigData(value));
+}
+
+void ByamlStreamWriter::addUInt64(u64 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_ULONG, addBigData(value));
+}
+
+void ByamlStreamWriter::addDouble(f64 value) {
+    addEntry(nullptr, ByamlDataType::TYPE_DOUBLE,
+             addBigData(*reinterpret_cast<const u64*>(&value)));
+}
+
+void ByamlStreamWriter::addString(const char* value) {
+    addEntry(nullptr, ByamlDataType::TYPE_STRING, addStringData(value));
+}
+
+void ByamlStreamWriter::addNull() {
+    addEntry(nullptr, ByamlDataType::TYPE_NULL, 0);
+}
+
+void ByamlStreamWriter::addBool(const char* key, bool value) {
+    addEntry(key, ByamlDataType::TYPE_BOOL, value);
+}
+
+void ByamlStreamWriter::addInt(const char* key, s32 value) {
+    addEntry(key, ByamlDataType::TYPE_INT, value);
+}
+
+void ByamlStreamWriter::addUInt(const char* key, u32 value) {
+    addEntry(key, ByamlDataType::TYPE_UINT, value);
+}
+
+void ByamlStreamWriter::addFloat(const char* key, f32 value) {
+    addEntry(key, ByamlDataType::TYPE_FLOAT, *reinterpret_cast<const u32*>(&value));
+}
+
+void ByamlStreamWriter::addInt64(const char* key, s64 value) {
+    addEntry(key, ByamlDataType::TYPE_LONG, addBigData(value));
+}
+
+void ByamlStreamWriter::addUInt64(const char* key, u64 value) {
+    addEntry(key, ByamlDataType::TYPE_ULONG, addBigData(value));
+}
+
+void ByamlStreamWriter::addDouble(const char* key, f64 value) {
+    addEntry(key, ByamlDataType::TYPE_DOUBLE,
+             addBigData(*reinterpret_cast<const u64*>(&value)));
+}
+
+void ByamlStreamWriter::addString(const char* key, const char* value) {
+    addEntry(key, ByamlDataType::TYPE_STRING, addStringData(value));
+}
+
+void ByamlStreamWriter::addNull(const char* key) {
+    addEntry(key, ByamlDataType::TYPE_NULL, 0);
+}
+
+void ByamlStreamWriter::pushContainer(const char* key, bool isHash) {
+    if (mIsRootPopped || (mCurrentContainerIndex < 0 && key)) {
+        mIsError = true;
+        return;
+    }
+    if (mCurrentContainerIndex + 1 >= mContainerStackSize) {
+        mIsOverflow = true;
+        return;
+    }
+
+    mCurrentContainerIndex++;
+    mContainerStack[mCurrentContainerIndex] = {key, mEntryNum, isHash};
+}
+
+void ByamlStreamWriter::pushHash() {
+    pushContainer(nullptr, true);
+}
+
+void ByamlStreamWriter::pushArray() {
+    pushContainer(nullptr, false);
+}
+
+void ByamlStreamWriter::pushHash(const char* key) {
+    pushContainer(key, true);
+}
+
+void ByamlStreamWriter::pushArray(const char* key) {
+    pushContainer(key, false);
+}
+
+void ByamlStreamWriter::pop() {
+    if (mCurrentContainerIndex < 0 || mIsRootPopped) {
+        mIsError = true;
+        return;
+    }
+
+    // the root container stays on the entry stack until finish() has written the string tables
+    if (mCurrentContainerIndex == 0) {
+        mIsRootPopped = true;
+        return;
+    }
+
+    const Container& container = mContainerStack[mCurrentContainerIndex];
+    u32 offset = writeContainer(container);
+    mEntryNum = container.entryIndex;
+    mCurrentContainerIndex--;
+    addEntry(container.key,
+             container.isHash ? ByamlDataType::TYPE_HASH : ByamlDataType::TYPE_ARRAY, offset);
+}
+
+u32 ByamlStreamWriter::writeContainer(const Container& container) {
+    s32 size = mEntryNum - container.entryIndex;
+    u32 pack_size = container.isHash ? size * 8 + 4 : size * 4 + ((size + 7) & ~3);
+    if (!tryReserve(pack_size))
+        return 0;
+
+    u32 offset = mWriteSize;
+    u8* node = &mBuffer[offset];
+    u32* header = reinterpret_cast<u32*>(node);
+    mWriteSize += pack_size;
+
+    if (container.isHash) {
+        header[0] = ByamlDataType::TYPE_HASH | (size << 8);
+
+        // entries grow downwards, so the last one added has the lowest address
+        Entry* entries = getEntry(mEntryNum - 1);
+        qsort(entries, size, sizeof(Entry), [](const void* a, const void* b) {
+            return strcmp(static_cast<const Entry*>(a)->key, static_cast<const Entry*>(b)->key);
+        });
+
+        for (s32 i = 0; i < size; i++) {
+            header[i * 2 + 1] = mKeyTable->calcId(entries[i].key) | (entries[i].type << 24);
+            header[i * 2 + 2] = entries[i].value;
+        }
+        return offset;
+    }
+
+    header[0] = ByamlDataType::TYPE_ARRAY | (size << 8);
+    u32* data_table = reinterpret_cast<u32*>(&node[(size + 7) & ~3]);
+    for (s32 i = 0; i < size; i++) {
+        const Entry* entry = getEntry(container.entryIndex + i);
+        node[i + 4] = entry->type;
+        data_table[i] = entry->value;
+    }
+    for (s32 i = size + 4; i < ((size + 7) & ~3); i++)
+        node[i] = 0;
+    return offset;
+}
+
+void ByamlStreamWriter::patchStringIndex(u32 offset) const {
+    u8* node = &mBuffer[offset];
+    s32 size = *reinterpret_cast<const u32*>(node) >> 8;
+    bool is_hash = node[0] == ByamlDataType::TYPE_HASH;
+    u32* pairs = reinterpret_cast<u32*>(&node[4]);
+    u32* data_table = reinterpret_cast<u32*>(&node[(size + 7) & ~3]);
+
+    for (s32 i = 0; i < size; i++) {
+        u8 type;
+        u32* value;
+        if (is_hash) {
+            type = pairs[i * 2] >> 24;
+            pairs[i * 2] = mKeyTable->getIndexById(pairs[i * 2] & 0xFFFFFF) | (type << 24);
+            value = &pairs[i * 2 + 1];
+        } else {
+            type = node[i + 4];
+            value = &data_table[i];
+        }
+
+        if (type == ByamlDataType::TYPE_STRING)
+            *value = mStringTable->getIndexById(*value);
+        else if (type == ByamlDataType::TYPE_HASH || type == ByamlDataType::TYPE_ARRAY)
+            patchStringIndex(*value);
+    }
+}
+
+// Writes the string tables and the root container, then replaces the key and string ids with
+// their sorted indices. Returns the size of the finished BYAML, or 0 if it did not fit or the writer
+// was misused. Calling it again returns the same size without writing anything.
+u32 ByamlStreamWriter::finish() {
+    if (mFinishSize != 0)
+        return mFinishSize;
+    if (!mIsRootPopped || mIsOverflow || mIsError)
+        return 0;
+
+    sead::ScopedCurrentHeapSetter setter{mHeap};
+    mKeyTable->makeIndex();
+    mStringTable->makeIndex();
+
+    // the space of both tables was reserved while they were filled
+    mStringTableSize = 0;
+    u32 key_table_offset = 0;
+    if (!mKeyTable->isEmpty()) {
+        key_table_offset = mWriteSize;
+        mWriteSize += mKeyTable->write(&mBuffer[mWriteSize]);
+    }
+
+    u32 string_table_offset = 0;
+    if (!mStringTable->isEmpty()) {
+        string_table_offset = mWriteSize;
+        mWriteSize += mStringTable->write(&mBuffer[mWriteSize]);
+    }
+
+    u32 root_offset = writeContainer(mContainerStack[0]);
+    if (mIsOverflow)
+        return 0;
+    mEntryNum = 0;
+    patchStringIndex(root_offset);
+
+    u16* tag = reinterpret_cast<u16*>(mBuffer);
+    tag[0] = 0x4259;
+    tag[1] = 3;
+    u32* offsets = reinterpret_cast<u32*>(mBuffer);
+    offsets[1] = key_table_offset;
+    offsets[2] = string_table_offset;
+    offsets[3] = root_offset;
+    mFinishSize = mWriteSize;
+    return mFinishSize;
+}
+
+}  // namespace al
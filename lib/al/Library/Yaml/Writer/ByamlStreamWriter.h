@@ -0,0 +1,103 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+namespace sead {
+class Heap;
+}  // namespace sead
+
+namespace al {
+
+class ByamlWriterStringTable;
+
+// Writes a BYAML into a fixed-size buffer while it is being built. Every container is written as
+// soon as it is popped, so apart from the string tables only the entries of the currently open
+// containers are held. Those are kept at the end of the output buffer itself.
+//
+// Keys and strings are written as ids and replaced by their sorted indices in finish(). The root
+// container is written last, after the string tables, to keep the layout verifiByaml expects.
+// Space for the string tables is reserved in the buffer as strings are added, so the heap held by
+// them stays proportional to the buffer size.
+//
+// Adding without a key to a hash, with a key to an array, or after the root was popped sets the
+// error flag, as does popping without an open container. finish() returns 0 once either flag is
+// set.
+class ByamlStreamWriter {
+public:
+    ByamlStreamWriter(sead::Heap* heap, u8* buffer, u32 bufferSize);
+    virtual ~ByamlStreamWriter();
+
+    void addBool(bool);
+    void addInt(s32);
+    void addUInt(u32);
+    void addFloat(f32);
+    void addInt64(s64);
+    void addUInt64(u64);
+    void addDouble(f64);
+    void addString(const char*);
+    void addNull();
+    void addBool(const char*, bool);
+    void addInt(const char*, s32);
+    void addUInt(const char*, u32);
+    void addFloat(const char*, f32);
+    void addInt64(const char*, s64);
+    void addUInt64(const char*, u64);
+    void addDouble(const char*, f64);
+    void addString(const char*, const char*);
+    void addNull(const char*);
+
+    void pushHash();
+    void pushArray();
+    void pushHash(const char*);
+    void pushArray(const char*);
+    void pop();
+    u32 finish();
+
+    bool isOverflow() const { return mIsOverflow; }
+    bool isError() const { return mIsError; }
+
+    u32 getWriteSize() const { return mWriteSize; }
+
+private:
+    struct Entry {
+        const char* key;
+        u32 value;
+        u8 type;
+    };
+
+    struct Container {
+        const char* key;
+        s32 entryIndex;
+        bool isHash;
+    };
+
+    void addEntry(const char* key, u8 type, u32 value);
+    u32 addBigData(u64 value);
+    u32 addStringData(const char* value);
+    const char* tryAddString(ByamlWriterStringTable* table, const char* string);
+    void pushContainer(const char* key, bool isHash);
+    u32 writeContainer(const Container& container);
+    bool tryReserve(u32 size);
+    void patchStringIndex(u32 offset) const;
+
+    Entry* getEntry(s32 index) const { return &mEntryTable[-index - 1]; }
+
+    sead::Heap* mHeap;
+    u8* mBuffer;
+    u32 mBufferSize;
+    u32 mWriteSize = 16;
+    u32 mStringTableSize = 0;
+    u32 mFinishSize = 0;
+    Entry* mEntryTable;
+    s32 mEntryNum = 0;
+    ByamlWriterStringTable* mKeyTable = nullptr;
+    ByamlWriterStringTable* mStringTable = nullptr;
+    Container* mContainerStack = nullptr;
+    s32 mContainerStackSize = 64;
+    s32 mCurrentContainerIndex = -1;
+    bool mIsRootPopped = false;
+    bool mIsOverflow = false;
+    bool mIsError = false;
+};
+
+}  // namespace al
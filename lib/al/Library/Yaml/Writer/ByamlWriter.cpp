@@ -1,5 +1,6 @@
 #include "Library/Yaml/Writer/ByamlWriter.h"
 
+#include <heap/seadFrameHeap.h>
 #include <heap/seadHeapMgr.h>
 #include <stream/seadStream.h>
 
@@ -10,6 +11,18 @@
 
 namespace al {
 
+namespace {
+sead::Heap* createArenaHeap(sead::Heap* heap, u32 size) {
+    // sead::FrameHeap::create takes all free space of heap for a size of 0
+    if (size == 0)
+        return heap;
+
+    sead::Heap* arena = sead::FrameHeap::create(size, "ByamlWriterArena", heap, 8,
+                                                sead::Heap::cHeapDirection_Forward, false);
+    return arena ? arena : heap;
+}
+}  // namespace
+
 ByamlWriter::ByamlWriter(sead::Heap* heap, bool _alwaysFalse)
     : mHeap(heap), _mAlwaysFalse(_alwaysFalse) {
     sead::ScopedCurrentHeapSetter setter{mHeap};
@@ -19,7 +32,23 @@ ByamlWriter::ByamlWriter(sead::Heap* heap, bool _alwaysFalse)
     mContainerStack = new ByamlWriterContainer*[mContainerStackSize];
 }
 
+// All nodes are bump allocated from a frame heap of arenaSize bytes created on heap, which is
+// destroyed at once instead of deleting every node. If arenaSize is 0 or the arena cannot be
+// created, nodes are allocated from heap directly.
+ByamlWriter::ByamlWriter(sead::Heap* heap, bool _alwaysFalse, u32 arenaSize)
+    : ByamlWriter(createArenaHeap(heap, arenaSize), _alwaysFalse) {
+    if (mHeap != heap)
+        mArenaHeap = static_cast<sead::FrameHeap*>(mHeap);
+}
+
 ByamlWriter::~ByamlWriter() {
+    // everything the writer allocates, including the string table index built by write(), comes
+    // from mHeap, which is the arena here
+    if (mArenaHeap) {
+        mArenaHeap->destroy();
+        return;
+    }
+
     if (_mAlwaysFalse) {
         delete mStringTable1;
         delete mStringTable2;
@@ -322,6 +351,10 @@ u32 ByamlWriter::calcPackSize() const {
 
 // NON_MATCHING: offsetBigDataList increased "too early"
 void ByamlWriter::write(sead::WriteStream* stream) {
+    sead::ScopedCurrentHeapSetter setter{mHeap};
+    mStringTable1->makeIndex();
+    mStringTable2->makeIndex();
+
     stream->writeU16(0x4259);
     stream->writeU16(3);
 
@@ -346,6 +379,12 @@ void ByamlWriter::write(sead::WriteStream* stream) {
         container->writeContainer(stream);
 }
 
+u32 ByamlWriter::calcArenaUsedSize() const {
+    if (!mArenaHeap)
+        return 0;
+    return mArenaHeap->getSize() - mArenaHeap->getFreeSize();
+}
+
 void ByamlWriter::print() const {
     if (mStringTable1)
         mStringTable1->print();
@@ -3,6 +3,7 @@
 #include <container/seadTList.h>
 
 namespace sead {
+class FrameHeap;
 class Heap;
 class WriteStream;
 }  // namespace sead
@@ -21,6 +22,7 @@ class ByamlIter;
 class ByamlWriter {
 public:
     ByamlWriter(sead::Heap*, bool);
+    ByamlWriter(sead::Heap*, bool, u32 arenaSize);
     virtual ~ByamlWriter();
 
     void addBool(bool);
@@ -57,6 +59,8 @@ public:
     u32 calcHeaderSize() const;
     u32 calcPackSize() const;
     void write(sead::WriteStream*);
+    // Returns 0 if the writer does not use an arena.
+    u32 calcArenaUsedSize() const;
     void print() const;
 
 private:
@@ -69,6 +73,7 @@ private:
     s32 mContainerStackSize = 64;
     s32 mCurrentContainerIndex = -1;
     bool _mAlwaysFalse;
+    sead::FrameHeap* mArenaHeap = nullptr;
 };
 
 }  // namespace al
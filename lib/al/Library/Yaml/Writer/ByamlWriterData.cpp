@@ -1,5 +1,6 @@
 #include "Library/Yaml/Writer/ByamlWriterData.h"
 
+#include <cstring>
 #include <stream/seadStream.h>
 
 #include "Library/Yaml/ByamlUtil.h"
@@ -22,6 +23,8 @@ bool ByamlWriterData::isContainer() const {
 
 void ByamlWriterData::makeIndex() {}
 
+void ByamlWriterData::write(sead::WriteStream*) const {}
+
 void ByamlWriterData::print(s32) const {}
 
 void ByamlWriterData::printIndent(s32) const {}
@@ -329,7 +332,7 @@ bool ByamlWriterArray::isArray() const {
 }
 
 ByamlWriterHashPair::ByamlWriterHashPair(const char* key, ByamlWriterData* value)
-    : mKey(key), mValue(value) {}
+    : sead::TListNode<ByamlWriterHashPair*>(this), mKey(key), mValue(value) {}
 
 ByamlWriterHash::ByamlWriterHash(ByamlWriterStringTable* stringTable1,
                                  ByamlWriterStringTable* stringTable2)
@@ -337,13 +340,35 @@ ByamlWriterHash::ByamlWriterHash(ByamlWriterStringTable* stringTable1,
 
 ByamlWriterHash::~ByamlWriterHash() {
     while (auto* node = mList.popBack())
-        delete node;
+        delete node->mData;
+}
+
+void ByamlWriterHash::deleteData() {
+    for (auto* pair : mList) {
+        if (!pair->getValue()->isContainer())
+            delete pair->getValue();
+    }
 }
 
 u32 ByamlWriterHash::calcPackSize() const {
     return mList.size() * 8 + 4;
 }
 
+// NON_MATCHING: written from the file format. Pairs are kept sorted by key, which is the order
+// of the key indices they are written with.
+void ByamlWriterHash::addData(const char* key, ByamlWriterData* data) {
+    auto* pair = new ByamlWriterHashPair(mStringTable1->tryAdd(key), data);
+
+    sead::TListNode<ByamlWriterHashPair*>* node = mList.back();
+    while (node && strcmp(node->mData->getKey(), pair->getKey()) > 0)
+        node = mList.prev(node);
+
+    if (node)
+        mList.insertAfter(node, pair);
+    else
+        mList.pushFront(pair);
+}
+
 void ByamlWriterHash::addBool(const char* key, bool value) {
     addData(key, new ByamlWriterBool(value));
 }
@@ -392,10 +417,27 @@ u8 ByamlWriterHash::getTypeCode() const {
     return 0xC1;
 }
 
+// NON_MATCHING: written from the file format
+void ByamlWriterHash::writeContainer(sead::WriteStream* stream) const {
+    stream->writeU8(0xC1);
+    alByamlLocalUtil::writeU24(stream, mList.size());
+
+    for (auto* pair : mList) {
+        alByamlLocalUtil::writeU24(stream, mStringTable1->calcIndex(pair->getKey()));
+        stream->writeU8(pair->getValue()->getTypeCode());
+        pair->getValue()->write(stream);
+    }
+}
+
 void ByamlWriterHash::write(sead::WriteStream* stream) const {
     stream->writeU32(getOffset());
 }
 
+void ByamlWriterHash::print(s32 unknown) const {
+    for (auto* pair : mList)
+        pair->getValue()->print(unknown + 1);
+}
+
 bool ByamlWriterHash::isHash() const {
     return true;
 }
@@ -219,17 +219,15 @@ private:
 
 static_assert(sizeof(ByamlWriterArray) == 0x30);
 
-class ByamlWriterHashPair : public sead::ListNode {
+class ByamlWriterHashPair : public sead::TListNode<ByamlWriterHashPair*> {
 public:
     ByamlWriterHashPair(const char*, ByamlWriterData*);
 
-    const char* getKey() { return mKey; }
+    const char* getKey() const { return mKey; }
 
-    ByamlWriterData* getValue() { return mValue; }
+    ByamlWriterData* getValue() const { return mValue; }
 
 private:
-    void* mSelfReference = this;
-    void* unk = nullptr;
     const char* mKey;
     ByamlWriterData* mValue;
 };
@@ -241,10 +239,10 @@ public:
     ByamlWriterHash(ByamlWriterStringTable*, ByamlWriterStringTable*);
     ~ByamlWriterHash();
 
-    void deleteData() override;  // TODO implementation missing
+    void deleteData() override;
     u32 calcPackSize() const override;
 
-    void addData(const char*, ByamlWriterData*);  // TODO implementation missing
+    void addData(const char*, ByamlWriterData*);
     void addBool(const char*, bool) override;
     void addInt(const char*, s32) override;
     void addUInt(const char*, u32) override;
@@ -258,13 +256,13 @@ public:
     void addNull(const char*) override;
 
     u8 getTypeCode() const override;
-    void writeContainer(sead::WriteStream*) const override;  // TODO implementation missing
+    void writeContainer(sead::WriteStream*) const override;
     void write(sead::WriteStream*) const override;
-    void print(s32) const override;  // TODO implementation missing
+    void print(s32) const override;
     bool isHash() const override;
 
 private:
-    sead::TList<ByamlWriterHashPair> mList;  // TODO not really... it's something different here.
+    sead::TList<ByamlWriterHashPair*> mList;
     ByamlWriterStringTable* mStringTable1;
     ByamlWriterStringTable* mStringTable2;
 };
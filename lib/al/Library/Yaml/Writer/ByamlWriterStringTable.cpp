@@ -1,62 +1,122 @@
 #include "Library/Yaml/Writer/ByamlWriterStringTable.h"
 
 #include <basis/seadTypes.h>
+#include <cstdlib>
+#include <cstring>
 #include <stream/seadStream.h>
 
+#include "Library/Base/HashCodeUtil.h"
 #include "Library/Yaml/ByamlUtil.h"
 
 namespace al {
 
+namespace {
+constexpr s32 cInitialTableCapacity = 64;
+constexpr u32 cChunkSize = 0x1000;
+}  // namespace
+
 ByamlWriterStringTable::ByamlWriterStringTable() = default;
 
+// NON_MATCHING: frees the hash set, the index arrays and the string chunks instead of the list
 ByamlWriterStringTable::~ByamlWriterStringTable() {
-    while (auto* node = mList.popBack()) {
-        node->mList = nullptr;
-        delete[] node->mData;
-        delete node;
+    delete[] mEntries;
+    delete[] mSortedEntries;
+    delete[] mIndexById;
+
+    while (mChunk) {
+        Chunk* next = mChunk->next;
+        delete[] reinterpret_cast<u8*>(mChunk);
+        mChunk = next;
     }
 }
 
-inline char* add(const char* string, sead::TList<const char*>& list) {
-    s32 length = ((strlen(string) << 32) + 0x100000000LL) >> 32;
-    char* array = new char[length];
-    strncpy(array, string, length);
-    auto* node = new sead::TListNode<const char*>(array);
-    list.pushBack(node);
-    return array;
+char* ByamlWriterStringTable::allocString(u32 size) {
+    if (!mChunk || mChunk->size - mChunk->usedSize < size) {
+        u32 chunk_size = size > cChunkSize ? size : cChunkSize;
+        Chunk* chunk = reinterpret_cast<Chunk*>(new u8[sizeof(Chunk) + chunk_size]);
+        chunk->next = mChunk;
+        chunk->size = chunk_size;
+        chunk->usedSize = 0;
+        mChunk = chunk;
+    }
+
+    char* string = reinterpret_cast<char*>(mChunk + 1) + mChunk->usedSize;
+    mChunk->usedSize += size;
+    return string;
 }
 
-const char* ByamlWriterStringTable::tryAdd(const char* string) {
-    for (auto it = mList.robustBegin(); it != mList.robustEnd(); ++it) {
-        s32 result = strcmp(string, it->mData);
-        if (result == 0)
-            return it->mData;
-        if (result < 0) {
-            s32 length = (s64)((strlen(string) << 32) + 0x100000000LL) >> 32;
-            char* array = new char[length];
-            char* result = strncpy(array, string, length);
-            auto* node = new sead::TListNode<const char*>(result);
-            mList.insertBefore(&*it, node);
-            return result;
-        }
+const ByamlWriterStringTable::Entry* ByamlWriterStringTable::findEntry(const char* string,
+                                                                       s32 hash) const {
+    if (mCapacity == 0)
+        return nullptr;
+
+    u32 mask = mCapacity - 1;
+    for (u32 i = hash & mask;; i = (i + 1) & mask) {
+        const Entry& entry = mEntries[i];
+        if (!entry.string)
+            return nullptr;
+        if (entry.hash == hash && strcmp(entry.string, string) == 0)
+            return &entry;
     }
-    s32 length = (s64)((strlen(string) << 32) + 0x100000000LL) >> 32;
-    char* array = new char[length];
-    char* result = strncpy(array, string, length);
-    auto* node = new sead::TListNode<const char*>(result);
-    mList.pushBack(node);
-    return result;
 }
 
+ByamlWriterStringTable::Entry* ByamlWriterStringTable::insertEntry(const char* string, s32 hash,
+                                                                    s32 id) {
+    u32 mask = mCapacity - 1;
+    u32 i = hash & mask;
+    while (mEntries[i].string)
+        i = (i + 1) & mask;
+
+    mEntries[i] = {string, hash, -1, id};
+    return &mEntries[i];
+}
+
+void ByamlWriterStringTable::expandTable() {
+    Entry* old_entries = mEntries;
+    s32 old_capacity = mCapacity;
+
+    mCapacity = old_capacity == 0 ? cInitialTableCapacity : old_capacity * 2;
+    mEntries = new Entry[mCapacity];
+    for (s32 i = 0; i < mCapacity; i++)
+        mEntries[i] = {nullptr, 0, -1, -1};
+
+    for (s32 i = 0; i < old_capacity; i++)
+        if (old_entries[i].string)
+            insertEntry(old_entries[i].string, old_entries[i].hash, old_entries[i].id);
+
+    delete[] old_entries;
+}
+
+// NON_MATCHING: the original walks the sorted list with strcmp and inserts a copy of the string in
+// front of the first greater one
+const char* ByamlWriterStringTable::tryAdd(const char* string) {
+    s32 hash = calcHashCode(string);
+    const Entry* entry = findEntry(string, hash);
+    if (entry)
+        return entry->string;
+
+    if ((mSize + 1) * 2 > mCapacity)
+        expandTable();
+
+    u32 length = strlen(string) + 1;
+    char* copy = allocString(length);
+    memcpy(copy, string, length);
+
+    insertEntry(copy, hash, mSize);
+    mSize++;
+    mContentSize += length;
+    mIsIndexed = false;
+    return copy;
+}
+
+// NON_MATCHING: the string count is kept instead of read from the list
 u32 ByamlWriterStringTable::calcHeaderSize() const {
-    return (4 * mList.size()) + 8;
+    return (4 * mSize) + 8;
 }
 
+// NON_MATCHING: the content size is summed in tryAdd instead of over the list
 u32 ByamlWriterStringTable::calcContentSize() const {
-    u32 size = 0;
-    for (auto& node : mList)
-        size += strlen(node) + 1;
-    return (size + 3) & 0xFFFFFFFC;
+    return (mContentSize + 3) & 0xFFFFFFFC;
 }
 
 u32 ByamlWriterStringTable::calcPackSize() const {
@@ -65,39 +125,74 @@ u32 ByamlWriterStringTable::calcPackSize() const {
     return calcHeaderSize() + calcContentSize();
 }
 
+// NON_MATCHING: the string count is kept instead of read from the list
 bool ByamlWriterStringTable::isEmpty() const {
-    return mList.size() == 0;
+    return mSize == 0;
 }
 
-u32 ByamlWriterStringTable::calcIndex(const char* data) const {
-    s32 i = 0;
-    for (auto& node : mList) {
-        if (!strcmp(data, node))
-            return i;
-        i++;
+void ByamlWriterStringTable::makeIndex() const {
+    if (mIsIndexed)
+        return;
+
+    delete[] mSortedEntries;
+    delete[] mIndexById;
+    mSortedEntries = new const Entry*[mSize];
+    mIndexById = new s32[mSize];
+
+    s32 num = 0;
+    for (s32 i = 0; i < mCapacity; i++)
+        if (mEntries[i].string)
+            mSortedEntries[num++] = &mEntries[i];
+
+    qsort(mSortedEntries, mSize, sizeof(const Entry*), [](const void* a, const void* b) {
+        return strcmp((*static_cast<const Entry* const*>(a))->string,
+                      (*static_cast<const Entry* const*>(b))->string);
+    });
+
+    for (s32 i = 0; i < mSize; i++) {
+        const_cast<Entry*>(mSortedEntries[i])->index = i;
+        mIndexById[mSortedEntries[i]->id] = i;
     }
-    return -1;
+    mIsIndexed = true;
 }
 
+// NON_MATCHING: a hash lookup of the sorted index instead of a strcmp walk over the list
+u32 ByamlWriterStringTable::calcIndex(const char* data) const {
+    const Entry* entry = findEntry(data, calcHashCode(data));
+    if (!entry)
+        return -1;
+    makeIndex();
+    return entry->index;
+}
+
+s32 ByamlWriterStringTable::getIndexById(s32 id) const {
+    makeIndex();
+    return mIndexById[id];
+}
+
+s32 ByamlWriterStringTable::calcId(const char* data) const {
+    const Entry* entry = findEntry(data, calcHashCode(data));
+    return entry ? entry->id : -1;
+}
+
+// NON_MATCHING: writes the strings in the sorted index order instead of walking the list
 void ByamlWriterStringTable::write(sead::WriteStream* stream) const {
     if (isEmpty())
         return;
+    makeIndex();
     stream->writeU8(0xC2);
-    alByamlLocalUtil::writeU24(stream, mList.size());
-
-    s32 i = 4 * (mList.size() + 2);
+    alByamlLocalUtil::writeU24(stream, mSize);
 
-    s32 v7 = 0;
-    auto end = mList.end();
-    for (auto it = mList.begin();; i += v7 + 1, ++it) {
+    s32 i = 4 * (mSize + 2);
+    for (s32 j = 0; j < mSize; j++) {
         stream->writeU32(i);
-        if (it == end)
-            break;
-        v7 = strlen(*it);
+        i += strlen(mSortedEntries[j]->string) + 1;
     }
+    stream->writeU32(i);
 
-    for (auto node : mList) {
-        stream->writeMemBlock(node, strlen(node));
+    for (s32 j = 0; j < mSize; j++) {
+        const char* string = mSortedEntries[j]->string;
+        stream->writeMemBlock(string, strlen(string));
         stream->writeU8(0);
     }
 
@@ -111,8 +206,35 @@ void ByamlWriterStringTable::write(sead::WriteStream* stream) const {
         stream->writeU8(0);
 }
 
+// Same layout as write(sead::WriteStream*), for writers that fill a buffer directly. Returns the
+// number of bytes written, which is calcPackSize().
+u32 ByamlWriterStringTable::write(u8* buffer) const {
+    if (isEmpty())
+        return 0;
+    makeIndex();
+
+    u32* header = reinterpret_cast<u32*>(buffer);
+    header[0] = 0xC2 | (mSize << 8);
+
+    u32 offset = 4 * (mSize + 2);
+    for (s32 i = 0; i < mSize; i++) {
+        const char* string = mSortedEntries[i]->string;
+        u32 length = strlen(string) + 1;
+        header[i + 1] = offset;
+        memcpy(&buffer[offset], string, length);
+        offset += length;
+    }
+    header[mSize + 1] = offset;
+
+    for (; offset & 3; offset++)
+        buffer[offset] = 0;
+    return offset;
+}
+
+// NON_MATCHING: walks the strings in the sorted index order instead of the list
 void ByamlWriterStringTable::print() const {
-    for (auto& node : mList)
+    makeIndex();
+    for (s32 i = 0; i < mSize; i++)
         ;
 }
 
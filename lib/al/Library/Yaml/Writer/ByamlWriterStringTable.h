@@ -1,7 +1,6 @@
 #pragma once
 
 #include <basis/seadTypes.h>
-#include <container/seadTList.h>
 
 namespace sead {
 class WriteStream;
@@ -9,6 +8,13 @@ class WriteStream;
 
 namespace al {
 
+// Deduplicating string table. Strings are copied into arena chunks and looked up through an
+// open addressing hash set. The sorted order is built on first use after the last tryAdd, either
+// by makeIndex or by any of the index and write functions, after which calcIndex is a single hash
+// lookup. The index arrays come from the current heap at that point. Strings also keep the id
+// they were added with, so ByamlStreamWriter can write ids first and patch in the sorted indices
+// at the end.
+// NON_MATCHING: the original class holds only the strings in a sorted sead::TList (0x18)
 class ByamlWriterStringTable {
 public:
     ByamlWriterStringTable();
@@ -18,12 +24,43 @@ public:
     u32 calcContentSize() const;
     u32 calcPackSize() const;
     bool isEmpty() const;
+    void makeIndex() const;
     u32 calcIndex(const char*) const;
+    s32 calcId(const char*) const;
+    s32 getIndexById(s32 id) const;
     void write(sead::WriteStream*) const;
+    u32 write(u8*) const;
     void print() const;
 
+    s32 getSize() const { return mSize; }
+
 private:
-    sead::TList<const char*> mList;
+    struct Entry {
+        const char* string;
+        s32 hash;
+        s32 index;
+        s32 id;
+    };
+
+    struct Chunk {
+        Chunk* next;
+        u32 size;
+        u32 usedSize;
+    };
+
+    const Entry* findEntry(const char*, s32) const;
+    Entry* insertEntry(const char*, s32, s32);
+    void expandTable();
+    char* allocString(u32);
+
+    Entry* mEntries = nullptr;
+    s32 mCapacity = 0;
+    s32 mSize = 0;
+    u32 mContentSize = 0;
+    mutable const Entry** mSortedEntries = nullptr;
+    mutable s32* mIndexById = nullptr;
+    mutable bool mIsIndexed = true;
+    Chunk* mChunk = nullptr;
 };
 
 }  // namespace al
@@ -0,0 +1,15 @@
+#include "Project/Execute/ExecuteAsyncExecutor.h"
+
+#ifdef AL_SENSOR_HIT_BROADPHASE
+
+#include "Project/HitSensor/SensorHitCheckJobQueue.h"
+
+namespace al {
+
+void ExecuteAsyncExecutorHitCheck::execute() {
+    mJobQueue->executeJobs(mThreadIndex);
+}
+
+}  // namespace al
+
+#endif
@@ -12,6 +12,7 @@ class DelegateThread;
 
 namespace al {
 class ExecuteDirector;
+class SensorHitCheckJobQueue;
 
 class ExecuteAsyncExecutor : public HioNode {
 public:
@@ -56,4 +57,22 @@ public:
 
 static_assert(sizeof(ExecuteAsyncExecutorUpdate) == 0x28);
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+// Runs its share of the sensor hit check jobs on another core.
+class ExecuteAsyncExecutorHitCheck : public ExecuteAsyncExecutor {
+public:
+    ExecuteAsyncExecutorHitCheck(const ExecuteDirector* director, const char* name,
+                                 sead::CoreId coreId, SensorHitCheckJobQueue* jobQueue,
+                                 s32 threadIndex)
+        : ExecuteAsyncExecutor(director, name, coreId), mJobQueue(jobQueue),
+          mThreadIndex(threadIndex) {}
+
+    void execute() override;
+
+private:
+    SensorHitCheckJobQueue* mJobQueue;
+    s32 mThreadIndex;
+};
+#endif
+
 }  // namespace al
@@ -56,8 +56,18 @@ public:
     void update();
     void addHitSensor(HitSensor*);
 
+    HitSensorType getType() const { return mSensorType; }
+
+    LiveActor* getParentActor() const { return mParentActor; }
+
+    u16 getSensorCount() const { return mSensorCount; }
+
+    HitSensor* getSensor(s32 index) const { return mSensors[index]; }
+
     const sead::Vector3f& getFollowPosOffset() const { return mFollowPosOffset; }
 
+    const sead::Vector3f& getPos() const { return mPos; }
+
     f32 getRadius() const { return mRadius; }
 
     void setFollowPosOffset(const sead::Vector3f& offset) { mFollowPosOffset.set(offset); }
@@ -4,6 +4,9 @@
 #include "Library/Execute/ExecuteTableHolderUpdate.h"
 #include "Library/LiveActor/ActorSensorFunction.h"
 #include "Project/HitSensor/HitSensor.h"
+#ifdef AL_SENSOR_HIT_BROADPHASE
+#include "Project/HitSensor/SensorHitCheckJobQueue.h"
+#endif
 #include "Project/HitSensor/SensorHitGroup.h"
 
 namespace al {
@@ -16,6 +19,10 @@ HitSensorDirector::HitSensorDirector(ExecuteDirector* parent) {
     mSimple = new SensorHitGroup(1536, "Simple");
     mMapObj = new SensorHitGroup(1536, "MapObj");
     mCharacter = new SensorHitGroup(1024, "Character");
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    // NON_MATCHING: the job queue is not in the original director
+    mCheckJobQueue = new SensorHitCheckJobQueue(parent);
+#endif
     registerExecutorUser(this, parent, "センサー");
 }
 
@@ -28,6 +35,18 @@ void HitSensorDirector::execute() {
     mSimple->clear();
     mMapObj->clear();
     mCharacter->clear();
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    // NON_MATCHING: the checks below are only queued, and run together at the end
+    mPlayer->updatePackedData();
+    mPlayerEye->updatePackedData();
+    mRide->updatePackedData();
+    mEye->updatePackedData();
+    mLookAt->updatePackedData();
+    mSimple->updatePackedData();
+    mMapObj->updatePackedData();
+    mCharacter->updatePackedData();
+    mCheckJobQueue->clear();
+#endif
     executeHitCheckInSameGroup(mPlayer);
     executeHitCheckGroup(mPlayer, mPlayerEye);
     executeHitCheckGroup(mPlayer, mCharacter);
@@ -50,8 +69,22 @@ void HitSensorDirector::execute() {
     executeHitCheckGroup(mEye, mLookAt);
     executeHitCheckGroup(mCharacter, mMapObj);
     executeHitCheckInSameGroup(mCharacter);
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    mCheckJobQueue->execute();
+#endif
 }
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+// NON_MATCHING: only queues the checks, which run together at the end of execute()
+void HitSensorDirector::executeHitCheckInSameGroup(SensorHitGroup* group) const {
+    mCheckJobQueue->addSameGroup(group);
+}
+
+// NON_MATCHING: same as executeHitCheckInSameGroup
+void HitSensorDirector::executeHitCheckGroup(SensorHitGroup* group, SensorHitGroup* group2) const {
+    mCheckJobQueue->addGroupPair(group, group2);
+}
+#else
 void HitSensorDirector::executeHitCheckInSameGroup(SensorHitGroup* group) const {
     s32 sensorCount = group->getSensorCount();
     for (s32 i = 0; i < sensorCount; i++) {
@@ -74,6 +107,7 @@ void HitSensorDirector::executeHitCheckGroup(SensorHitGroup* group, SensorHitGro
         }
     }
 }
+#endif
 
 void HitSensorDirector::executeHitCheck(HitSensor* sensor, HitSensor* otherSensor) const {
     if (sensor->mParentActor == otherSensor->mParentActor)
@@ -6,6 +6,7 @@
 namespace al {
 class ExecuteDirector;
 class HitSensor;
+class SensorHitCheckJobQueue;
 class SensorHitGroup;
 
 class HitSensorDirector : public IUseExecutor, public IUseHioNode {
@@ -29,8 +30,15 @@ private:
     SensorHitGroup* mSimple = nullptr;
     SensorHitGroup* mMapObj = nullptr;
     SensorHitGroup* mCharacter = nullptr;
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    SensorHitCheckJobQueue* mCheckJobQueue = nullptr;
+#endif
 };
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+static_assert(sizeof(HitSensorDirector) == 0x50);
+#else
 static_assert(sizeof(HitSensorDirector) == 0x48);
+#endif
 
 }  // namespace al
@@ -0,0 +1,193 @@
+#include "Project/HitSensor/SensorHitCheckJobQueue.h"
+
+#ifdef AL_SENSOR_HIT_BROADPHASE
+
+#include <basis/seadRawPrint.h>
+
+#include "Project/Execute/ExecuteAsyncExecutor.h"
+#include "Project/HitSensor/HitSensor.h"
+#include "Project/HitSensor/SensorHitGrid.h"
+#include "Project/HitSensor/SensorHitGroup.h"
+
+namespace al {
+namespace {
+constexpr s32 cMaxJobNum = 256;
+constexpr s32 cMaxJobNumPerPair = 8;
+// a group pair gets at least one job as long as there are no more pairs than this
+static_assert(cMaxJobNum >= SensorHitCheckJobQueue::cMaxGroupPairNum * cMaxJobNumPerPair);
+constexpr s32 cMinJobRowNum = 32;
+// per thread, jobs that do not fit are checked again while adding the hit sensors
+constexpr s32 cPairBufferSize = 8192;
+// below this many sensor pairs, checking every pair is cheaper than building the grid
+constexpr s32 cGridMinPairNum = 4096;
+// below this many sensor pairs in total, waking up the workers costs more than it saves
+constexpr s32 cParallelMinPairNum = 32768;
+}  // namespace
+
+SensorHitCheckJobQueue::SensorHitCheckJobQueue(const ExecuteDirector* director) {
+    mJobs = new Job[cMaxJobNum];
+    for (s32 i = 0; i < cThreadNum; i++) {
+        mPairBuffers[i] = new SensorPair[cPairBufferSize];
+        mPairBufferSizes[i] = 0;
+    }
+    mWorkers[0] = new ExecuteAsyncExecutorHitCheck(director, "センサー(コア1)", 1, this, 1);
+    mWorkers[1] = new ExecuteAsyncExecutorHitCheck(director, "センサー(コア2)", 2, this, 2);
+}
+
+void SensorHitCheckJobQueue::clear() {
+    mJobNum = 0;
+    mPairNum = 0;
+}
+
+void SensorHitCheckJobQueue::addGroupPair(SensorHitGroup* group, SensorHitGroup* group2) {
+    addJobs(group, group2, false);
+}
+
+void SensorHitCheckJobQueue::addSameGroup(SensorHitGroup* group) {
+    addJobs(group, group, true);
+}
+
+// Splits the rows of the group into jobs, and builds the grid the jobs look up, since the grid
+// must not be built while the jobs run.
+void SensorHitCheckJobQueue::addJobs(SensorHitGroup* group, SensorHitGroup* group2,
+                                     bool isSameGroup) {
+    s32 row_num = group->getSensorCount();
+    s32 pair_num = row_num * group2->getSensorCount();
+    if (pair_num == 0)
+        return;
+
+    const SensorHitGrid* grid = nullptr;
+    if (pair_num >= (isSameGroup ? cGridMinPairNum * 2 : cGridMinPairNum))
+        grid = group2->updateGrid();
+    mPairNum += isSameGroup ? pair_num / 2 : pair_num;
+
+    s32 job_num = (row_num + cMinJobRowNum - 1) / cMinJobRowNum;
+    if (job_num > cMaxJobNumPerPair)
+        job_num = cMaxJobNumPerPair;
+    // fewer jobs still cover every row, but a pair without any job would never be checked
+    SEAD_ASSERT_MSG(mJobNum < cMaxJobNum, "too many sensor group pairs, at most %d",
+                    cMaxGroupPairNum);
+    if (job_num > cMaxJobNum - mJobNum)
+        job_num = cMaxJobNum - mJobNum;
+    for (s32 i = 0; i < job_num; i++) {
+        Job& job = mJobs[mJobNum++];
+        job.group = group;
+        job.group2 = group2;
+        job.grid = grid;
+        job.rowBegin = row_num * i / job_num;
+        job.rowEnd = row_num * (i + 1) / job_num;
+        job.isSameGroup = isSameGroup;
+        job.isOverflow = false;
+        job.threadIndex = 0;
+        job.pairBegin = 0;
+        job.pairEnd = 0;
+    }
+}
+
+void SensorHitCheckJobQueue::execute() {
+    mNextJobIndex.store(0);
+    for (s32 i = 0; i < cThreadNum; i++)
+        mPairBufferSizes[i] = 0;
+
+    bool is_parallel = mPairNum >= cParallelMinPairNum;
+    if (is_parallel)
+        for (s32 i = 0; i < cWorkerNum; i++)
+            mWorkers[i]->executeAsync();
+    executeJobs(0);
+    if (is_parallel)
+        for (s32 i = 0; i < cWorkerNum; i++)
+            mWorkers[i]->waitAsync();
+
+    for (s32 i = 0; i < mJobNum; i++) {
+        const Job& job = mJobs[i];
+        if (job.isOverflow) {
+            visitOverlapPairs(job, [&](s32 index, s32 otherIndex) {
+                addHitSensors(job, index, otherIndex);
+                return true;
+            });
+            continue;
+        }
+
+        const SensorPair* pairs = mPairBuffers[job.threadIndex];
+        for (s32 p = job.pairBegin; p < job.pairEnd; p++)
+            addHitSensors(job, pairs[p].index, pairs[p].otherIndex);
+    }
+}
+
+// Takes jobs until none are left and stores their overlapping pairs in the buffer of the thread.
+// Only reads the sensors, the hit sensors are added by execute() afterwards.
+void SensorHitCheckJobQueue::executeJobs(s32 threadIndex) {
+    SensorPair* pairs = mPairBuffers[threadIndex];
+    s32& size = mPairBufferSizes[threadIndex];
+    for (s32 i = mNextJobIndex.fetch_add(1); i < mJobNum; i = mNextJobIndex.fetch_add(1)) {
+        Job& job = mJobs[i];
+        job.threadIndex = threadIndex;
+        job.pairBegin = size;
+        job.isOverflow = !visitOverlapPairs(job, [&](s32 index, s32 otherIndex) {
+            if (size == cPairBufferSize)
+                return false;
+            pairs[size].index = index;
+            pairs[size].otherIndex = otherIndex;
+            size++;
+            return true;
+        });
+        job.pairEnd = size;
+    }
+}
+
+// Visits the overlapping pairs of sensors with different parents, in the order of the nested
+// loops over the rows of the job and the sensors of group2. Stops when the visitor returns false.
+template <typename Visitor>
+bool SensorHitCheckJobQueue::visitOverlapPairs(const Job& job, Visitor visitor) const {
+    const SensorHitGroup* group2 = job.group2;
+    s32 sensor_count = group2->getSensorCount();
+    s32 word_num = (sensor_count + 63) / 64;
+    u64 last_word_mask = sensor_count % 64 == 0 ? ~0ull : (1ull << (sensor_count % 64)) - 1;
+    u64 candidates[SensorHitGrid::cCandidateWordNum];
+
+    for (s32 index = job.rowBegin; index < job.rowEnd; index++) {
+        const HitSensor* sensor = job.group->getSensor(index);
+        const LiveActor* parent_actor = job.group->getParentActor(index);
+        if (job.grid) {
+            for (s32 w = 0; w < word_num; w++)
+                candidates[w] = 0;
+            job.grid->collectCandidates(candidates, sensor->getPos(), sensor->getRadius());
+        }
+
+        // only the sensors from index on in the same group, like the serial checks
+        s32 first_word = job.isSameGroup ? index / 64 : 0;
+        for (s32 w = first_word; w < word_num; w++) {
+            u64 word = job.grid ? candidates[w] : ~0ull;
+            if (w == word_num - 1)
+                word &= last_word_mask;
+            if (job.isSameGroup && w == first_word)
+                word &= ~0ull << (index % 64);
+            if (word == 0)
+                continue;
+
+            u64 overlaps =
+                group2->calcOverlapMask(w, word, sensor->getPos(), sensor->getRadius());
+            for (; overlaps != 0; overlaps &= overlaps - 1) {
+                s32 other_index = w * 64 + __builtin_ctzll(overlaps);
+                if (parent_actor == group2->getParentActor(other_index))
+                    continue;
+                if (!visitor(index, other_index))
+                    return false;
+            }
+        }
+    }
+    return true;
+}
+
+void SensorHitCheckJobQueue::addHitSensors(const Job& job, s32 index, s32 otherIndex) const {
+    HitSensor* sensor = job.group->getSensor(index);
+    HitSensor* other_sensor = job.group2->getSensor(otherIndex);
+    if (job.group2->isDetectable(otherIndex))
+        sensor->addHitSensor(other_sensor);
+    if (job.group->isDetectable(index))
+        other_sensor->addHitSensor(sensor);
+}
+
+}  // namespace al
+
+#endif
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+
+#ifdef AL_SENSOR_HIT_BROADPHASE
+
+#include <atomic>
+
+namespace al {
+class ExecuteAsyncExecutorHitCheck;
+class ExecuteDirector;
+class SensorHitGrid;
+class SensorHitGroup;
+
+// Hit checks between pairs of sensor groups, split into jobs of a few rows each. The overlapping
+// sensor pairs are found on the calling thread and two more cores at once, each into a buffer of
+// its own, and are then added to the sensors on the calling thread in the order of the jobs. That
+// is the order of the serial checks, so every sensor gets its hit sensors in the same order.
+// The two workers are threads of their own on cores 1 and 2, created with the queue. They are
+// not the view update executors of LiveActorKit, since those always run the view update, and they
+// wait on their events outside the sensor phase. Only built with AL_SENSOR_HIT_BROADPHASE.
+class SensorHitCheckJobQueue {
+public:
+    static constexpr s32 cWorkerNum = 2;
+    static constexpr s32 cThreadNum = cWorkerNum + 1;
+    static constexpr s32 cMaxGroupPairNum = 32;
+
+    SensorHitCheckJobQueue(const ExecuteDirector* director);
+
+    void clear();
+    void addGroupPair(SensorHitGroup* group, SensorHitGroup* group2);
+    void addSameGroup(SensorHitGroup* group);
+    void execute();
+    void executeJobs(s32 threadIndex);
+
+private:
+    struct Job {
+        SensorHitGroup* group;
+        SensorHitGroup* group2;
+        const SensorHitGrid* grid;
+        s16 rowBegin;
+        s16 rowEnd;
+        bool isSameGroup;
+        bool isOverflow;
+        s32 threadIndex;
+        s32 pairBegin;
+        s32 pairEnd;
+    };
+
+    struct SensorPair {
+        u16 index;
+        u16 otherIndex;
+    };
+
+    void addJobs(SensorHitGroup* group, SensorHitGroup* group2, bool isSameGroup);
+    template <typename Visitor>
+    bool visitOverlapPairs(const Job& job, Visitor visitor) const;
+    void addHitSensors(const Job& job, s32 index, s32 otherIndex) const;
+
+    Job* mJobs;
+    s32 mJobNum = 0;
+    s32 mPairNum = 0;
+    std::atomic<s32> mNextJobIndex{0};
+    SensorPair* mPairBuffers[cThreadNum];
+    s32 mPairBufferSizes[cThreadNum];
+    ExecuteAsyncExecutorHitCheck* mWorkers[cWorkerNum];
+};
+}  // namespace al
+
+#endif
@@ -0,0 +1,159 @@
+#include "Project/HitSensor/SensorHitGrid.h"
+
+#ifdef AL_SENSOR_HIT_BROADPHASE
+
+#include <math/seadMathCalcCommon.h>
+
+namespace al {
+
+namespace {
+// per sensor in the grid, two cells along every axis. Cells are as wide as a sensor of twice the
+// average radius, more spread out sensors are kept in the list of large sensors
+constexpr s32 cMaxCellNumPerSensor = 8;
+// per lookup, larger lookups take every sensor of the group as a candidate
+constexpr s32 cMaxCellNumPerLookup = 64;
+constexpr f32 cMinCellSize = 100.0f;
+// grows every sensor a little, so that rounding never loses a pair the exact check would find.
+// The relative part covers the rounding of positions far from the origin
+constexpr f32 cBoundsMargin = 1.0f;
+constexpr f32 cRelativeBoundsMargin = 1.0f / (1 << 20);
+// positions are a few float steps apart at most below this, non-finite positions fail the check
+constexpr f32 cMaxCoord = 1.0e7f;
+
+void setAllCandidates(u64* candidates, s32 sensorCount) {
+    s32 word_num = (sensorCount + 63) / 64;
+    for (s32 i = 0; i < word_num; i++)
+        candidates[i] = ~0ull;
+    if (sensorCount % 64 != 0)
+        candidates[word_num - 1] = (1ull << (sensorCount % 64)) - 1;
+}
+}  // namespace
+
+// The bucket starts are u16, cMaxSensorNum sensors with cMaxCellNumPerSensor cells each fit.
+SensorHitGrid::SensorHitGrid(s32 maxSensors) : mMaxSensors(maxSensors) {
+    mBucketNum = 64;
+    while (mBucketNum < maxSensors * 2)
+        mBucketNum *= 2;
+    mBucketStart = new u16[mBucketNum + 1];
+    mEntries = new u16[maxSensors * cMaxCellNumPerSensor];
+    mLargeSensors = new u16[maxSensors];
+}
+
+SensorHitGrid::~SensorHitGrid() {
+    delete[] mBucketStart;
+    delete[] mEntries;
+    delete[] mLargeSensors;
+}
+
+u32 SensorHitGrid::calcMemorySize() const {
+    return sizeof(SensorHitGrid) + (mBucketNum + 1) * sizeof(u16) +
+           mMaxSensors * cMaxCellNumPerSensor * sizeof(u16) + mMaxSensors * sizeof(u16);
+}
+
+// Counting sort of the sensors into the buckets of every cell their bounds touch.
+void SensorHitGrid::build(const f32* posX, const f32* posY, const f32* posZ, const f32* radius,
+                          s32 sensorCount) {
+    mSensorCount = sensorCount;
+    mLargeSensorNum = 0;
+    if (sensorCount <= 0)
+        return;
+
+    f32 radius_sum = 0.0f;
+    for (s32 i = 0; i < sensorCount; i++)
+        radius_sum += sead::Mathf::abs(radius[i]);
+    mCellSize = sead::Mathf::max(cMinCellSize, 4.0f * (radius_sum / sensorCount + cBoundsMargin));
+    mInvCellSize = 1.0f / mCellSize;
+
+    for (s32 i = 0; i <= mBucketNum; i++)
+        mBucketStart[i] = 0;
+
+    for (s32 i = 0; i < sensorCount; i++) {
+        s32 cell_min[3];
+        s32 cell_max[3];
+        if (!tryCalcCellRange(cell_min, cell_max, {posX[i], posY[i], posZ[i]}, radius[i],
+                              cMaxCellNumPerSensor)) {
+            mLargeSensors[mLargeSensorNum++] = i;
+            continue;
+        }
+        for (s32 z = cell_min[2]; z <= cell_max[2]; z++)
+            for (s32 y = cell_min[1]; y <= cell_max[1]; y++)
+                for (s32 x = cell_min[0]; x <= cell_max[0]; x++)
+                    mBucketStart[calcBucket(x, y, z)]++;
+    }
+
+    for (s32 i = 1; i < mBucketNum; i++)
+        mBucketStart[i] += mBucketStart[i - 1];
+    mBucketStart[mBucketNum] = mBucketStart[mBucketNum - 1];
+
+    // every bucket is filled from its end, which leaves the bucket starts in place afterwards
+    for (s32 i = sensorCount - 1; i >= 0; i--) {
+        s32 cell_min[3];
+        s32 cell_max[3];
+        if (!tryCalcCellRange(cell_min, cell_max, {posX[i], posY[i], posZ[i]}, radius[i],
+                              cMaxCellNumPerSensor))
+            continue;
+        for (s32 z = cell_min[2]; z <= cell_max[2]; z++)
+            for (s32 y = cell_min[1]; y <= cell_max[1]; y++)
+                for (s32 x = cell_min[0]; x <= cell_max[0]; x++)
+                    mEntries[--mBucketStart[calcBucket(x, y, z)]] = i;
+    }
+}
+
+// Sets the bit of every sensor whose bounds may overlap the sphere. Sensors that actually touch
+// it are always included, so the exact check over the candidates finds the same pairs.
+void SensorHitGrid::collectCandidates(u64* candidates, const sead::Vector3f& pos,
+                                      f32 radius) const {
+    s32 cell_min[3];
+    s32 cell_max[3];
+    if (!tryCalcCellRange(cell_min, cell_max, pos, radius, cMaxCellNumPerLookup)) {
+        setAllCandidates(candidates, mSensorCount);
+        return;
+    }
+
+    for (s32 i = 0; i < mLargeSensorNum; i++)
+        candidates[mLargeSensors[i] / 64] |= 1ull << (mLargeSensors[i] % 64);
+
+    for (s32 z = cell_min[2]; z <= cell_max[2]; z++) {
+        for (s32 y = cell_min[1]; y <= cell_max[1]; y++) {
+            for (s32 x = cell_min[0]; x <= cell_max[0]; x++) {
+                u32 bucket = calcBucket(x, y, z);
+                for (s32 i = mBucketStart[bucket]; i < mBucketStart[bucket + 1]; i++)
+                    candidates[mEntries[i] / 64] |= 1ull << (mEntries[i] % 64);
+            }
+        }
+    }
+}
+
+bool SensorHitGrid::tryCalcCellRange(s32* cellMin, s32* cellMax, const sead::Vector3f& pos,
+                                     f32 radius, s32 maxCellNum) const {
+    const f32 coords[3] = {pos.x, pos.y, pos.z};
+    f32 extent = sead::Mathf::abs(radius) + cBoundsMargin;
+    if (!(extent < cMaxCoord))
+        return false;
+
+    s32 cell_num = 1;
+    for (s32 axis = 0; axis < 3; axis++) {
+        f32 coord_size = sead::Mathf::abs(coords[axis]);
+        if (!(coord_size < cMaxCoord))
+            return false;
+        f32 axis_extent = extent + coord_size * cRelativeBoundsMargin;
+        cellMin[axis] =
+            static_cast<s32>(sead::Mathf::floor((coords[axis] - axis_extent) * mInvCellSize));
+        cellMax[axis] =
+            static_cast<s32>(sead::Mathf::floor((coords[axis] + axis_extent) * mInvCellSize));
+        cell_num *= cellMax[axis] - cellMin[axis] + 1;
+        if (cell_num > maxCellNum)
+            return false;
+    }
+    return true;
+}
+
+u32 SensorHitGrid::calcBucket(s32 x, s32 y, s32 z) const {
+    u32 hash = static_cast<u32>(x) * 73856093u ^ static_cast<u32>(y) * 19349663u ^
+               static_cast<u32>(z) * 83492791u;
+    return hash & (mBucketNum - 1);
+}
+
+}  // namespace al
+
+#endif
@@ -0,0 +1,51 @@
+#pragma once
+
+#ifdef AL_SENSOR_HIT_BROADPHASE
+
+#include <math/seadVector.h>
+
+namespace al {
+
+// Spatial hash over the sensors of one SensorHitGroup, rebuilt every frame before the hit
+// checks. Lookups return candidates as a bit per sensor index, so callers can visit them in the
+// same order as a full scan over the group.
+// A grid takes about 26 bytes per sensor the group can hold: 16 for the bucket entries of up to 8
+// cells per sensor, up to 8 for the bucket starts and 2 for the list of large sensors. The eight
+// groups of HitSensorDirector hold 6144 sensors and their grids take about 140KB together.
+class SensorHitGrid {
+public:
+    static constexpr s32 cMaxSensorNum = 2048;
+    static constexpr s32 cCandidateWordNum = cMaxSensorNum / 64;
+
+    SensorHitGrid(s32 maxSensors);
+    ~SensorHitGrid();
+
+    // Takes the packed sensor data of the group, see SensorHitGroup::updatePackedData.
+    void build(const f32* posX, const f32* posY, const f32* posZ, const f32* radius,
+               s32 sensorCount);
+    void collectCandidates(u64* candidates, const sead::Vector3f& pos, f32 radius) const;
+
+    s32 getSensorCount() const { return mSensorCount; }
+
+    s32 getLargeSensorNum() const { return mLargeSensorNum; }
+
+    u32 calcMemorySize() const;
+
+private:
+    bool tryCalcCellRange(s32* cellMin, s32* cellMax, const sead::Vector3f& pos, f32 radius,
+                          s32 maxCellNum) const;
+    u32 calcBucket(s32 x, s32 y, s32 z) const;
+
+    s32 mMaxSensors;
+    s32 mSensorCount = 0;
+    f32 mCellSize = 1.0f;
+    f32 mInvCellSize = 1.0f;
+    s32 mBucketNum;
+    u16* mBucketStart = nullptr;
+    u16* mEntries = nullptr;
+    u16* mLargeSensors = nullptr;
+    s32 mLargeSensorNum = 0;
+};
+}  // namespace al
+
+#endif
@@ -1,11 +1,42 @@
 #include "Project/HitSensor/SensorHitGroup.h"
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+#ifdef __aarch64__
+#include <arm_neon.h>
+#endif
+
+#include "Project/HitSensor/HitSensor.h"
+#include "Project/HitSensor/SensorHitGrid.h"
+#endif
+
 namespace al {
 
 SensorHitGroup::SensorHitGroup(s32 maxSensors, const char* groupName)
     : mMaxSensors(maxSensors), mSensors(new HitSensor*[maxSensors]) {
     for (s32 i = 0; i < mMaxSensors; i++)
         mSensors[i] = nullptr;
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    // NON_MATCHING: the grid and the packed arrays are not in the original group. The arrays are
+    // padded to whole steps of four, so calcOverlapMask never reads past them
+    if (mMaxSensors <= SensorHitGrid::cMaxSensorNum)
+        mGrid = new SensorHitGrid(mMaxSensors);
+
+    s32 packed_size = (mMaxSensors + 3) & ~3;
+    mPosX = new f32[packed_size];
+    mPosY = new f32[packed_size];
+    mPosZ = new f32[packed_size];
+    mRadius = new f32[packed_size];
+    mParentActors = new const LiveActor*[packed_size];
+    mTypeBits = new u8[packed_size];
+    for (s32 i = 0; i < packed_size; i++) {
+        mPosX[i] = 0.0f;
+        mPosY[i] = 0.0f;
+        mPosZ[i] = 0.0f;
+        mRadius[i] = 0.0f;
+        mParentActors[i] = nullptr;
+        mTypeBits[i] = 0;
+    }
+#endif
 }
 
 void SensorHitGroup::add(HitSensor* pSensor) {
@@ -17,4 +48,87 @@ HitSensor* SensorHitGroup::getSensor(s32 idx) const {
     return mSensors[idx];
 }
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+// NON_MATCHING: not in the original group, frees what the constructor allocates
+SensorHitGroup::~SensorHitGroup() {
+    delete mGrid;
+    delete[] mPosX;
+    delete[] mPosY;
+    delete[] mPosZ;
+    delete[] mRadius;
+    delete[] mParentActors;
+    delete[] mTypeBits;
+    delete[] mSensors;
+}
+
+// Copies what the hit checks read of every sensor into the packed arrays, once per frame before
+// the checks, so that they do not have to load it from each sensor. Also drops the grid of the
+// previous frame.
+void SensorHitGroup::updatePackedData() {
+    for (s32 i = 0; i < mSensorCount; i++) {
+        const HitSensor* sensor = mSensors[i];
+        mPosX[i] = sensor->getPos().x;
+        mPosY[i] = sensor->getPos().y;
+        mPosZ[i] = sensor->getPos().z;
+        mRadius[i] = sensor->getRadius();
+        mParentActors[i] = sensor->getParentActor();
+        bool is_eye = sensor->getType() == HitSensorType::Eye ||
+                      sensor->getType() == HitSensorType::PlayerEye;
+        mTypeBits[i] = is_eye ? 0 : cTypeBitDetectable;
+    }
+    mIsGridValid = false;
+}
+
+// Builds the grid over the current sensor positions once per frame, after updatePackedData().
+// Groups larger than the grid can index have no grid and are checked without it.
+const SensorHitGrid* SensorHitGroup::updateGrid() {
+    if (mGrid && !mIsGridValid) {
+        mGrid->build(mPosX, mPosY, mPosZ, mRadius, mSensorCount);
+        mIsGridValid = true;
+    }
+    return mGrid;
+}
+
+// Returns the candidates among the 64 sensors of the word whose spheres overlap the given one,
+// with the same distance test as HitSensorDirector::executeHitCheck. Four sensors are tested per
+// step, and steps without candidates are skipped.
+u64 SensorHitGroup::calcOverlapMask(s32 wordIndex, u64 candidates, const sead::Vector3f& pos,
+                                    f32 radius) const {
+    const s32 base = wordIndex * 64;
+    u64 result = 0;
+#ifdef __aarch64__
+    static const u32 cLaneBits[4] = {1, 2, 4, 8};
+    for (s32 i = 0; i < 64; i += 4) {
+        u32 lanes = (candidates >> i) & 0xf;
+        if (lanes == 0)
+            continue;
+
+        // no fused multiply-add, which would round differently from the scalar test
+        s32 index = base + i;
+        float32x4_t dx = vsubq_f32(vdupq_n_f32(pos.x), vld1q_f32(&mPosX[index]));
+        float32x4_t dy = vsubq_f32(vdupq_n_f32(pos.y), vld1q_f32(&mPosY[index]));
+        float32x4_t dz = vsubq_f32(vdupq_n_f32(pos.z), vld1q_f32(&mPosZ[index]));
+        float32x4_t distance =
+            vaddq_f32(vaddq_f32(vmulq_f32(dx, dx), vmulq_f32(dy, dy)), vmulq_f32(dz, dz));
+        float32x4_t combined_radius = vaddq_f32(vdupq_n_f32(radius), vld1q_f32(&mRadius[index]));
+        uint32x4_t is_far = vcgeq_f32(distance, vmulq_f32(combined_radius, combined_radius));
+
+        u32 overlaps = vaddvq_u32(vbicq_u32(vld1q_u32(cLaneBits), is_far));
+        result |= static_cast<u64>(overlaps & lanes) << i;
+    }
+#else
+    for (u64 bits = candidates; bits != 0; bits &= bits - 1) {
+        s32 i = __builtin_ctzll(bits);
+        s32 index = base + i;
+        sead::Vector3f distance = {pos.x - mPosX[index], pos.y - mPosY[index],
+                                   pos.z - mPosZ[index]};
+        f32 combined_radius = radius + mRadius[index];
+        if (!(distance.squaredLength() >= sead::Mathf::square(combined_radius)))
+            result |= 1ull << i;
+    }
+#endif
+    return result;
+}
+#endif
+
 }  // namespace al
@@ -1,9 +1,16 @@
 #pragma once
 
 #include <basis/seadTypes.h>
+#ifdef AL_SENSOR_HIT_BROADPHASE
+#include <math/seadVector.h>
+#endif
 
 namespace al {
 class HitSensor;
+#ifdef AL_SENSOR_HIT_BROADPHASE
+class LiveActor;
+class SensorHitGrid;
+#endif
 
 class SensorHitGroup {
 public:
@@ -16,9 +23,37 @@ public:
 
     s32 getSensorCount() const { return mSensorCount; }
 
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    ~SensorHitGroup();
+
+    void updatePackedData();
+    const SensorHitGrid* updateGrid();
+    u64 calcOverlapMask(s32 wordIndex, u64 candidates, const sead::Vector3f& pos,
+                        f32 radius) const;
+
+    const LiveActor* getParentActor(s32 index) const { return mParentActors[index]; }
+
+    bool isDetectable(s32 index) const { return mTypeBits[index] & cTypeBitDetectable; }
+#endif
+
 private:
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    // set for sensors that are added to the hit sensors of the others, which eyes are not
+    static constexpr u8 cTypeBitDetectable = 1 << 0;
+#endif
+
     s32 mMaxSensors;
     s32 mSensorCount = 0;
     HitSensor** mSensors;
+#ifdef AL_SENSOR_HIT_BROADPHASE
+    SensorHitGrid* mGrid = nullptr;
+    bool mIsGridValid = false;
+    f32* mPosX = nullptr;
+    f32* mPosY = nullptr;
+    f32* mPosZ = nullptr;
+    f32* mRadius = nullptr;
+    const LiveActor** mParentActors = nullptr;
+    u8* mTypeBits = nullptr;
+#endif
 };
 }  // namespace al
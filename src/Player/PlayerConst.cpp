@@ -1,5 +1,9 @@
 #include "Player/PlayerConst.h"
 
+#ifdef AL_BYAML_SCHEMA
+#include "Library/Yaml/ByamlSchema.h"
+#endif
+
 PlayerConst::PlayerConst() {
     mGravity = 3.0;
     mFrictionAttack = 0.9;
@@ -618,6 +622,631 @@ PlayerConst::PlayerConst() {
     mAdditionalSpeedLimit = 30.0;
 }
 
+#ifdef AL_BYAML_SCHEMA
+// NON_MATCHING: reads through a key index schema instead of one tryGetFloatByKey per member
+PlayerConst::PlayerConst(const al::ByamlIter& byaml) {
+    static constexpr al::ByamlSchemaField<PlayerConst> cSchema[] = {
+        {"AdditionalSpeedLimit", &PlayerConst::mAdditionalSpeedLimit, 30.0f},
+        {"AnimFrameRateMaxDash", &PlayerConst::mAnimFrameRateMaxDash, 4.0f},
+        {"AnimFrameRateMaxDashFast", &PlayerConst::mAnimFrameRateMaxDashFast, 5.0f},
+        {"AnimFrameRateMaxRun", &PlayerConst::mAnimFrameRateMaxRun, 3.5f},
+        {"AnimFrameRateMaxRun2D", &PlayerConst::mAnimFrameRateMaxRun2D, 2.5f},
+        {"AnimFrameRateMinRun", &PlayerConst::mAnimFrameRateMinRun, 1.0f},
+        {"AnimFrameRateMinRun2D", &PlayerConst::mAnimFrameRateMinRun2D, 1.0f},
+        {"AnimFrameRateRange2D", &PlayerConst::mAnimFrameRateRange2D, 10.0f},
+        {"AnimFrameRateRunStart", &PlayerConst::mAnimFrameRateRunStart, 2.0f},
+        {"AnimFrameRateSpeedMax", &PlayerConst::mAnimFrameRateSpeedMax, 26.0f},
+        {"AnimFrameRateSpeedMin", &PlayerConst::mAnimFrameRateSpeedMin, 6.0f},
+        {"BrakeOnCounterBorder", &PlayerConst::mBrakeOnCounterBorder, 10},
+        {"BrakeOnSpeedRate", &PlayerConst::mBrakeOnSpeedRate, 0.5f},
+        {"BrakeTurnStartFrame", &PlayerConst::mBrakeTurnStartFrame, 5},
+        {"BrakeTurnStartFrame2D", &PlayerConst::mBrakeTurnStartFrame2D, 5},
+        {"CapCatchPopGravity", &PlayerConst::mCapCatchPopGravity, 0.8f},
+        {"CapCatchPopPower", &PlayerConst::mCapCatchPopPower, 10.0f},
+        {"CapChildLocalOffset", &PlayerConst::mCapChildLocalOffset, 100.0f},
+        {"CapFriction", &PlayerConst::mCapFriction, 0.2f},
+        {"CapHeadSpringJumpGravity", &PlayerConst::mCapHeadSpringJumpGravity, 1.2f},
+        {"CapHeadSpringJumpGravityHigh", &PlayerConst::mCapHeadSpringJumpGravityHigh, 1.0f},
+        {"CapHeadSpringJumpPower", &PlayerConst::mCapHeadSpringJumpPower, 18.0f},
+        {"CapHeadSpringJumpPowerHigh", &PlayerConst::mCapHeadSpringJumpPowerHigh, 22.0f},
+        {"CapHeadSpringSpeedMax", &PlayerConst::mCapHeadSpringSpeedMax, 16.0f},
+        {"CapInterpolateFrame", &PlayerConst::mCapInterpolateFrame, 15},
+        {"CapLeapFrogJumpGravity", &PlayerConst::mCapLeapFrogJumpGravity, 1.0f},
+        {"CapLeapFrogJumpPower", &PlayerConst::mCapLeapFrogJumpPower, 32.0f},
+        {"CapLeapFrogJumpPowerAir", &PlayerConst::mCapLeapFrogJumpPowerAir, 26.0f},
+        {"CapLimitDegree", &PlayerConst::mCapLimitDegree, 15.0f},
+        {"CapManHeroEyesWaitAppearFrame", &PlayerConst::mCapManHeroEyesWaitAppearFrame, 330},
+        {"CapStability", &PlayerConst::mCapStability, 0.75f},
+        {"CapTransFriction", &PlayerConst::mCapTransFriction, 0.25f},
+        {"CapTransLimit", &PlayerConst::mCapTransLimit, 10.0f},
+        {"CapTransStability", &PlayerConst::mCapTransStability, 0.95f},
+        {"CenterTiltRateMax", &PlayerConst::mCenterTiltRateMax, 0.0f},
+        {"CoinDashSpeed", &PlayerConst::mCoinDashSpeed, 6.0f},
+        {"CoinDashSpeedLimit", &PlayerConst::mCoinDashSpeedLimit, 6.0f},
+        {"CollisionHitDownAngleH", &PlayerConst::mCollisionHitDownAngleH, 55.0f},
+        {"CollisionHitDownEscapeAngleV", &PlayerConst::mCollisionHitDownEscapeAngleV, 30.0f},
+        {"CollisionRadius", &PlayerConst::mCollisionRadius, 55.0f},
+        {"CollisionRadiusSquat", &PlayerConst::mCollisionRadiusSquat, 45.0f},
+        {"CollisionRadiusStand", &PlayerConst::mCollisionRadiusStand, 45.0f},
+        {"CollisionResetLimit", &PlayerConst::mCollisionResetLimit, 20.0f},
+        {"CollisionSmallStepHeight", &PlayerConst::mCollisionSmallStepHeight, 25.0f},
+        {"ContinuousJumpCount", &PlayerConst::mContinuousJumpCount, 3},
+        {"ContinuousJumpPowerMin", &PlayerConst::mContinuousJumpPowerMin, 19.5f},
+        {"ContinuousJumpPreInputFrame", &PlayerConst::mContinuousJumpPreInputFrame, 5},
+        {"ContinuousJumpTimer", &PlayerConst::mContinuousJumpTimer, 10},
+        {"ContinuousLongJumpCount", &PlayerConst::mContinuousLongJumpCount, 3},
+        {"ContinuousLongJumpTimer", &PlayerConst::mContinuousLongJumpTimer, 15},
+        {"DamageCancelFrame", &PlayerConst::mDamageCancelFrame, 45},
+        {"DamageFireCeilHitSpeed", &PlayerConst::mDamageFireCeilHitSpeed, 1.0f},
+        {"DamageFireGravity", &PlayerConst::mDamageFireGravity, 0.9f},
+        {"DamageFireJumpMoveSpeed", &PlayerConst::mDamageFireJumpMoveSpeed, 10.0f},
+        {"DamageFireJumpPower1st", &PlayerConst::mDamageFireJumpPower1st, 20.0f},
+        {"DamageFireJumpPower2nd", &PlayerConst::mDamageFireJumpPower2nd, 20.0f},
+        {"DamageFireNoGravityFrame", &PlayerConst::mDamageFireNoGravityFrame, 20},
+        {"DamageFireRunAnimRate", &PlayerConst::mDamageFireRunAnimRate, 0.3f},
+        {"DamageFireRunBrakeFrame", &PlayerConst::mDamageFireRunBrakeFrame, 20.0f},
+        {"DamageFireRunSpeed", &PlayerConst::mDamageFireRunSpeed, 18.0f},
+        {"DamageFireRunTime", &PlayerConst::mDamageFireRunTime, 60},
+        {"DamageInvalidCount", &PlayerConst::mDamageInvalidCount, 240},
+        {"DamageInvalidCountAbyss", &PlayerConst::mDamageInvalidCountAbyss, 120},
+        {"DamageInvalidCountRecovery", &PlayerConst::mDamageInvalidCountRecovery, 20},
+        {"DamageSwimBrakeRateGround", &PlayerConst::mDamageSwimBrakeRateGround, 0.95f},
+        {"DamageSwimCancelFrame", &PlayerConst::mDamageSwimCancelFrame, 50},
+        {"DamageSwimGravity", &PlayerConst::mDamageSwimGravity, 0.02f},
+        {"DamageSwimPushPower", &PlayerConst::mDamageSwimPushPower, 3.0f},
+        {"DamageSwimSurfaceCancelFrame", &PlayerConst::mDamageSwimSurfaceCancelFrame, 40},
+        {"DamageSwimSurfaceGravity", &PlayerConst::mDamageSwimSurfaceGravity, 0.95f},
+        {"DamageSwimSurfaceHopPower", &PlayerConst::mDamageSwimSurfaceHopPower, 20.0f},
+        {"DamageSwimSurfaceLandBrake", &PlayerConst::mDamageSwimSurfaceLandBrake, 0.05f},
+        {"DamageSwimSurfaceLandEndSpeed", &PlayerConst::mDamageSwimSurfaceLandEndSpeed, 1.0f},
+        {"DamageSwimSurfaceLandSpeed", &PlayerConst::mDamageSwimSurfaceLandSpeed, 5.0f},
+        {"DamageSwimSurfacePushPower", &PlayerConst::mDamageSwimSurfacePushPower, 4.0f},
+        {"DashAccelFrame2D", &PlayerConst::mDashAccelFrame2D, 30},
+        {"DashBlendRange", &PlayerConst::mDashBlendRange, 1.0f},
+        {"DashBorderSpeed", &PlayerConst::mDashBorderSpeed, 15.0f},
+        {"DashFastBlendRange", &PlayerConst::mDashFastBlendRange, 1.0f},
+        {"DashFastBorderSpeed", &PlayerConst::mDashFastBorderSpeed, 20.0f},
+        {"DashJudgeSpeed", &PlayerConst::mDashJudgeSpeed, 14.5f},
+        {"DashMaxSpeed2D", &PlayerConst::mDashMaxSpeed2D, 17.0f},
+        {"DeadWipeStartAbyss", &PlayerConst::mDeadWipeStartAbyss, 30},
+        {"DeadWipeStartAbyssWithCapMsg", &PlayerConst::mDeadWipeStartAbyssWithCapMsg, 90},
+        {"DeadWipeStartDamage", &PlayerConst::mDeadWipeStartDamage, 30},
+        {"DeadWipeStartIceWater", &PlayerConst::mDeadWipeStartIceWater, 30},
+        {"DeadWipeStartNoOxygen", &PlayerConst::mDeadWipeStartNoOxygen, 30},
+        {"DeadWipeStartPress", &PlayerConst::mDeadWipeStartPress, 40},
+        {"DeadWipeStartSandSink", &PlayerConst::mDeadWipeStartSandSink, 30},
+        {"DeadWipeWaitAbyss", &PlayerConst::mDeadWipeWaitAbyss, 30},
+        {"DeadWipeWaitAbyssWithCapMsg", &PlayerConst::mDeadWipeWaitAbyssWithCapMsg, 30},
+        {"DeadWipeWaitDamage", &PlayerConst::mDeadWipeWaitDamage, 96},
+        {"DeadWipeWaitIceWater", &PlayerConst::mDeadWipeWaitIceWater, 96},
+        {"DeadWipeWaitNoOxygen", &PlayerConst::mDeadWipeWaitNoOxygen, 96},
+        {"DeadWipeWaitPress", &PlayerConst::mDeadWipeWaitPress, 96},
+        {"DeadWipeWaitSandSink", &PlayerConst::mDeadWipeWaitSandSink, 96},
+        {"DiveTrampleCancelFrame", &PlayerConst::mDiveTrampleCancelFrame, 20},
+        {"DiveTramplePower", &PlayerConst::mDiveTramplePower, 11.0f},
+        {"DownFallFrameMin", &PlayerConst::mDownFallFrameMin, 5},
+        {"EnableActionFrameCapCatch", &PlayerConst::mEnableActionFrameCapCatch, 10},
+        {"ExtendFrame", &PlayerConst::mExtendFrame, 10},
+        {"FallSpeedMax", &PlayerConst::mFallSpeedMax, 35.0f},
+        {"FallWallScaleVelocity", &PlayerConst::mFallWallScaleVelocity, 0.5f},
+        {"FrictionAir", &PlayerConst::mFrictionAir, 0.99f},
+        {"FrictionAttack", &PlayerConst::mFrictionAttack, 0.9f},
+        {"GrabCeilBodyRadius", &PlayerConst::mGrabCeilBodyRadius, 50.0f},
+        {"GrabCeilEnableFallSnapFrame", &PlayerConst::mGrabCeilEnableFallSnapFrame, 30},
+        {"GrabCeilEnableJumpEnergy", &PlayerConst::mGrabCeilEnableJumpEnergy, 6.5f},
+        {"GrabCeilEnableJumpEnergyMax", &PlayerConst::mGrabCeilEnableJumpEnergyMax, 10.0f},
+        {"GrabCeilEnableNextFrame", &PlayerConst::mGrabCeilEnableNextFrame, 10},
+        {"GrabCeilInputPowerBorder", &PlayerConst::mGrabCeilInputPowerBorder, 6.0f},
+        {"GrabCeilJumpForceAngle", &PlayerConst::mGrabCeilJumpForceAngle, 135.0f},
+        {"GrabCeilJumpGravity", &PlayerConst::mGrabCeilJumpGravity, 1.0f},
+        {"GrabCeilJumpInvalidFrame", &PlayerConst::mGrabCeilJumpInvalidFrame, 10},
+        {"GrabCeilJumpMoveMax", &PlayerConst::mGrabCeilJumpMoveMax, 15.0f},
+        {"GrabCeilJumpMoveMin", &PlayerConst::mGrabCeilJumpMoveMin, 15.0f},
+        {"GrabCeilJumpPower", &PlayerConst::mGrabCeilJumpPower, 20.0f},
+        {"GrabCeilLeavePopGravity", &PlayerConst::mGrabCeilLeavePopGravity, 1.2f},
+        {"GrabCeilLeavePopPower", &PlayerConst::mGrabCeilLeavePopPower, 3.0f},
+        {"GrabCeilLeaveSpeedMin", &PlayerConst::mGrabCeilLeaveSpeedMin, 1.0f},
+        {"GrabCeilRange", &PlayerConst::mGrabCeilRange, 100.0f},
+        {"GrabCeilReverseInputBorder", &PlayerConst::mGrabCeilReverseInputBorder, 6.0f},
+        {"GrabCeilSwingStartOffset", &PlayerConst::mGrabCeilSwingStartOffset, 1.0f},
+        {"GrabCeilSwingWaitEnergy", &PlayerConst::mGrabCeilSwingWaitEnergy, 6.5f},
+        {"Gravity", &PlayerConst::mGravity, 3.0f},
+        {"GravityAir", &PlayerConst::mGravityAir, 1.5f},
+        {"GravityDamage", &PlayerConst::mGravityDamage, 0.95f},
+        {"GravityMove", &PlayerConst::mGravityMove, 7.0f},
+        {"GravitySpinAir", &PlayerConst::mGravitySpinAir, 0.3f},
+        {"GravityWallSlide", &PlayerConst::mGravityWallSlide, 0.5f},
+        {"GroundSpinAccelRate", &PlayerConst::mGroundSpinAccelRate, 0.5f},
+        {"GroundSpinBrakeRate", &PlayerConst::mGroundSpinBrakeRate, 0.95f},
+        {"GroundSpinFrame", &PlayerConst::mGroundSpinFrame, 90},
+        {"GroundSpinMoveSpeedMax", &PlayerConst::mGroundSpinMoveSpeedMax, 8.0f},
+        {"HeadSlidingBrake", &PlayerConst::mHeadSlidingBrake, 0.5f},
+        {"HeadSlidingGravityAir", &PlayerConst::mHeadSlidingGravityAir, 2.0f},
+        {"HeadSlidingJump", &PlayerConst::mHeadSlidingJump, 28.0f},
+        {"HeadSlidingSideAccel", &PlayerConst::mHeadSlidingSideAccel, 0.125f},
+        {"HeadSlidingSpeed", &PlayerConst::mHeadSlidingSpeed, 20.0f},
+        {"HeadSlidingSpeedMin", &PlayerConst::mHeadSlidingSpeedMin, 2.5f},
+        {"HillAccelAddFrame", &PlayerConst::mHillAccelAddFrame, 60},
+        {"HillAccelSubAngleMax", &PlayerConst::mHillAccelSubAngleMax, 20.0f},
+        {"HillAccelSubAngleMin", &PlayerConst::mHillAccelSubAngleMin, 0.0f},
+        {"HillAccelSubFrame", &PlayerConst::mHillAccelSubFrame, 100},
+        {"HillAddSpeed", &PlayerConst::mHillAddSpeed, 15.0f},
+        {"HillAngleSpeedMax", &PlayerConst::mHillAngleSpeedMax, 26.0f},
+        {"HillAngleSpeedMin", &PlayerConst::mHillAngleSpeedMin, 21.0f},
+        {"HillPoseDegreeMax", &PlayerConst::mHillPoseDegreeMax, 45.0f},
+        {"HillSubSpeed", &PlayerConst::mHillSubSpeed, 0.0f},
+        {"HipDropGravity", &PlayerConst::mHipDropGravity, 45.0f},
+        {"HipDropHeight", &PlayerConst::mHipDropHeight, 40.0f},
+        {"HipDropLandCancelFrame", &PlayerConst::mHipDropLandCancelFrame, 24},
+        {"HipDropMsgInterval", &PlayerConst::mHipDropMsgInterval, 8},
+        {"HipDropSpeed", &PlayerConst::mHipDropSpeed, 45.0f},
+        {"HipDropSpeedMax", &PlayerConst::mHipDropSpeedMax, 45.0f},
+        {"HopPowerDamage", &PlayerConst::mHopPowerDamage, 12.0f},
+        {"IKBlendFrameRun", &PlayerConst::mIKBlendFrameRun, 60},
+        {"IKBlendRateRunMax", &PlayerConst::mIKBlendRateRunMax, 0.95f},
+        {"IKBlendRateRunMin", &PlayerConst::mIKBlendRateRunMin, 0.85f},
+        {"IceAccelFrame", &PlayerConst::mIceAccelFrame, 60},
+        {"IceBrakeFrame", &PlayerConst::mIceBrakeFrame, 120},
+        {"IceBrakeFrameHigh", &PlayerConst::mIceBrakeFrameHigh, 60},
+        {"IceBrakeFrameWall", &PlayerConst::mIceBrakeFrameWall, 15},
+        {"IceRoundAccelFrame", &PlayerConst::mIceRoundAccelFrame, 20},
+        {"IceRoundAccelFrameFast", &PlayerConst::mIceRoundAccelFrameFast, 1},
+        {"IceRoundBrakeFrame", &PlayerConst::mIceRoundBrakeFrame, 30},
+        {"IceRoundFastDegree", &PlayerConst::mIceRoundFastDegree, 45.0f},
+        {"IceRoundLimitDegree", &PlayerConst::mIceRoundLimitDegree, 25.0f},
+        {"IceRoundMinDegree", &PlayerConst::mIceRoundMinDegree, 3.0f},
+        {"IceWaterDamageInterval", &PlayerConst::mIceWaterDamageInterval, 300},
+        {"IceWaterRecoveryFrame", &PlayerConst::mIceWaterRecoveryFrame, 70},
+        {"JumpAccelBack", &PlayerConst::mJumpAccelBack, 1.0f},
+        {"JumpAccelFront", &PlayerConst::mJumpAccelFront, 0.5f},
+        {"JumpAccelTurn", &PlayerConst::mJumpAccelTurn, 0.3f},
+        {"JumpBaseSpeedMax", &PlayerConst::mJumpBaseSpeedMax, 24.0f},
+        {"JumpGravity", &PlayerConst::mJumpGravity, 1.5f},
+        {"JumpGravity2nd", &PlayerConst::mJumpGravity2nd, 1.5f},
+        {"JumpGravity3rd", &PlayerConst::mJumpGravity3rd, 1.0f},
+        {"JumpGravityCapCatch", &PlayerConst::mJumpGravityCapCatch, 1.3f},
+        {"JumpGravityForceRun", &PlayerConst::mJumpGravityForceRun, 1.0f},
+        {"JumpHipDropPermitBeginFrame", &PlayerConst::mJumpHipDropPermitBeginFrame, 5},
+        {"JumpHipDropPermitEndFrame", &PlayerConst::mJumpHipDropPermitEndFrame, 30},
+        {"JumpHipDropPower", &PlayerConst::mJumpHipDropPower, 40.0f},
+        {"JumpInertiaRate", &PlayerConst::mJumpInertiaRate, 0.7f},
+        {"JumpMoveSpeedMax", &PlayerConst::mJumpMoveSpeedMax, 30.0f},
+        {"JumpMoveSpeedMin", &PlayerConst::mJumpMoveSpeedMin, 11.0f},
+        {"JumpPowerCapCatch", &PlayerConst::mJumpPowerCapCatch, 22.0f},
+        {"JumpPowerForceRun", &PlayerConst::mJumpPowerForceRun, 18.0f},
+        {"JumpPowerMax", &PlayerConst::mJumpPowerMax, 19.5f},
+        {"JumpPowerMax2DArea", &PlayerConst::mJumpPowerMax2DArea, 27.5f},
+        {"JumpPowerMax2nd", &PlayerConst::mJumpPowerMax2nd, 21.0f},
+        {"JumpPowerMax3rd", &PlayerConst::mJumpPowerMax3rd, 25.0f},
+        {"JumpPowerMaxBorder2D", &PlayerConst::mJumpPowerMaxBorder2D, 18.0f},
+        {"JumpPowerMin", &PlayerConst::mJumpPowerMin, 17.0f},
+        {"JumpPowerMin2DArea", &PlayerConst::mJumpPowerMin2DArea, 23.5f},
+        {"JumpPowerMinBorder2D", &PlayerConst::mJumpPowerMinBorder2D, 12.0f},
+        {"JumpTurnAccelFrame", &PlayerConst::mJumpTurnAccelFrame, 20},
+        {"JumpTurnAccelFrameFast", &PlayerConst::mJumpTurnAccelFrameFast, 1},
+        {"JumpTurnAngleFast", &PlayerConst::mJumpTurnAngleFast, 135.0f},
+        {"JumpTurnAngleFastLimit", &PlayerConst::mJumpTurnAngleFastLimit, 25.0f},
+        {"JumpTurnAngleLimit", &PlayerConst::mJumpTurnAngleLimit, 6.0f},
+        {"JumpTurnAngleStart", &PlayerConst::mJumpTurnAngleStart, 1.0f},
+        {"JumpTurnBrakeFrame", &PlayerConst::mJumpTurnBrakeFrame, 10},
+        {"LongFallDistance", &PlayerConst::mLongFallDistance, 3000.0f},
+        {"LongJumpAccel", &PlayerConst::mLongJumpAccel, 0.25f},
+        {"LongJumpBrake", &PlayerConst::mLongJumpBrake, 0.5f},
+        {"LongJumpGravity", &PlayerConst::mLongJumpGravity, 0.48f},
+        {"LongJumpInitSpeed", &PlayerConst::mLongJumpInitSpeed, 14.0f},
+        {"LongJumpJumpPow", &PlayerConst::mLongJumpJumpPow, 12.0f},
+        {"LongJumpMovePow", &PlayerConst::mLongJumpMovePow, 4.0f},
+        {"LongJumpSideAccel", &PlayerConst::mLongJumpSideAccel, 0.25f},
+        {"LongJumpSpeed", &PlayerConst::mLongJumpSpeed, 23.0f},
+        {"LongJumpSpeedMin", &PlayerConst::mLongJumpSpeedMin, 2.5f},
+        {"LookAtEyeAngleMaxH", &PlayerConst::mLookAtEyeAngleMaxH, 85.0f},
+        {"LookAtEyeAngleMaxV", &PlayerConst::mLookAtEyeAngleMaxV, 60.0f},
+        {"LookAtEyeAngleMinH", &PlayerConst::mLookAtEyeAngleMinH, 35.0f},
+        {"LookAtEyeAngleMinInSightH", &PlayerConst::mLookAtEyeAngleMinInSightH, 10.0f},
+        {"LookAtEyeAngleMinInSightV", &PlayerConst::mLookAtEyeAngleMinInSightV, 10.0f},
+        {"LookAtEyeAngleMinV", &PlayerConst::mLookAtEyeAngleMinV, 10.0f},
+        {"LookAtEyeDistance", &PlayerConst::mLookAtEyeDistance, 500.0f},
+        {"LookAtEyeKeepFrame", &PlayerConst::mLookAtEyeKeepFrame, 30},
+        {"LookAtEyeKeepFrameInSight", &PlayerConst::mLookAtEyeKeepFrameInSight, 0},
+        {"LookAtEyeKeepFrameWait", &PlayerConst::mLookAtEyeKeepFrameWait, 120},
+        {"MoveAnimSpeedMax", &PlayerConst::mMoveAnimSpeedMax, 25.0f},
+        {"MustacheChildLocalOffset", &PlayerConst::mMustacheChildLocalOffset, 100.0f},
+        {"MustacheFriction", &PlayerConst::mMustacheFriction, 0.8f},
+        {"MustacheLimitDegree", &PlayerConst::mMustacheLimitDegree, 10.0f},
+        {"MustacheStability", &PlayerConst::mMustacheStability, 0.3f},
+        {"NormalAccelFrame", &PlayerConst::mNormalAccelFrame, 40},
+        {"NormalAccelFrame2D", &PlayerConst::mNormalAccelFrame2D, 15},
+        {"NormalBrakeFrame", &PlayerConst::mNormalBrakeFrame, 10},
+        {"NormalBrakeFrame2D", &PlayerConst::mNormalBrakeFrame2D, 10},
+        {"NormalDashAnimFrame", &PlayerConst::mNormalDashAnimFrame, 15},
+        {"NormalDashAnimFrame2D", &PlayerConst::mNormalDashAnimFrame2D, 15},
+        {"NormalMaxSpeed", &PlayerConst::mNormalMaxSpeed, 14.0f},
+        {"NormalMaxSpeed2D", &PlayerConst::mNormalMaxSpeed2D, 10.0f},
+        {"NormalMinSpeed", &PlayerConst::mNormalMinSpeed, 3.0f},
+        {"NormalMinSpeed2D", &PlayerConst::mNormalMinSpeed2D, 3.0f},
+        {"NoseChildLocalOffset", &PlayerConst::mNoseChildLocalOffset, 50.0f},
+        {"NoseFriction", &PlayerConst::mNoseFriction, 0.8f},
+        {"NoseLimitDegree", &PlayerConst::mNoseLimitDegree, 45.0f},
+        {"NoseStability", &PlayerConst::mNoseStability, 0.1f},
+        {"ObjLeapFrogJumpPower", &PlayerConst::mObjLeapFrogJumpPower, 20.0f},
+        {"ObjLeapFrogJumpPowerHigh", &PlayerConst::mObjLeapFrogJumpPowerHigh, 25.0f},
+        {"OxygenDamageInterval", &PlayerConst::mOxygenDamageInterval, 300},
+        {"OxygenNoReduceFrame", &PlayerConst::mOxygenNoReduceFrame, 60},
+        {"OxygenRecoveryFrame", &PlayerConst::mOxygenRecoveryFrame, 30},
+        {"OxygenReduceFrame", &PlayerConst::mOxygenReduceFrame, 1380},
+        {"PoleClimbCatchRange", &PlayerConst::mPoleClimbCatchRange, 50.0f},
+        {"PoleClimbCatchRangeMax", &PlayerConst::mPoleClimbCatchRangeMax, 100.0f},
+        {"PoleClimbCatchRangeMin", &PlayerConst::mPoleClimbCatchRangeMin, 10.0f},
+        {"PoleClimbDownFrame", &PlayerConst::mPoleClimbDownFrame, 1},
+        {"PoleClimbDownKeepTime", &PlayerConst::mPoleClimbDownKeepTime, 30},
+        {"PoleClimbDownSpeed", &PlayerConst::mPoleClimbDownSpeed, 10.0f},
+        {"PoleClimbDownSpeedFast", &PlayerConst::mPoleClimbDownSpeedFast, 15.0f},
+        {"PoleClimbDownSpeedSwing", &PlayerConst::mPoleClimbDownSpeedSwing, 20.0f},
+        {"PoleClimbInputDegreeMove", &PlayerConst::mPoleClimbInputDegreeMove, 50.0f},
+        {"PoleClimbInputRepeatAngle", &PlayerConst::mPoleClimbInputRepeatAngle, 10.0f},
+        {"PoleClimbJointAngleMax", &PlayerConst::mPoleClimbJointAngleMax, 25.0f},
+        {"PoleClimbJointAngleMin", &PlayerConst::mPoleClimbJointAngleMin, -25.0f},
+        {"PoleClimbJointRangeMax", &PlayerConst::mPoleClimbJointRangeMax, 80.0f},
+        {"PoleClimbJointRangeMin", &PlayerConst::mPoleClimbJointRangeMin, 15.0f},
+        {"PoleClimbMoveWallDegree", &PlayerConst::mPoleClimbMoveWallDegree, 5.0f},
+        {"PoleClimbPreInputSwing", &PlayerConst::mPoleClimbPreInputSwing, 15},
+        {"PoleClimbTurnDist", &PlayerConst::mPoleClimbTurnDist, 40.0f},
+        {"PoleClimbTurnFrame", &PlayerConst::mPoleClimbTurnFrame, 15},
+        {"PoleClimbTurnStopFrame", &PlayerConst::mPoleClimbTurnStopFrame, 5},
+        {"PoleClimbUpFrame", &PlayerConst::mPoleClimbUpFrame, 25},
+        {"PoleClimbUpFrameFast", &PlayerConst::mPoleClimbUpFrameFast, 17},
+        {"PoleClimbUpFrameSwing", &PlayerConst::mPoleClimbUpFrameSwing, 12},
+        {"PoleClimbUpMargine", &PlayerConst::mPoleClimbUpMargine, 40.0f},
+        {"PoleClimbUpSpeed", &PlayerConst::mPoleClimbUpSpeed, 100.0f},
+        {"PoleTopEndFrame", &PlayerConst::mPoleTopEndFrame, 10},
+        {"PoleTopEndUnderOffsetY", &PlayerConst::mPoleTopEndUnderOffsetY, 60.0f},
+        {"PoleTopStartFrame", &PlayerConst::mPoleTopStartFrame, 10},
+        {"PoleTopTurnSpeed", &PlayerConst::mPoleTopTurnSpeed, 4.0f},
+        {"PreInputFrameCapThrow", &PlayerConst::mPreInputFrameCapThrow, 10},
+        {"PushPower", &PlayerConst::mPushPower, 20.0f},
+        {"PushPowerDamage", &PlayerConst::mPushPowerDamage, 2.0f},
+        {"QuickTurnJumpFrame", &PlayerConst::mQuickTurnJumpFrame, 20},
+        {"ReflectCeilingPower", &PlayerConst::mReflectCeilingPower, 17.0f},
+        {"ReflectTossPower", &PlayerConst::mReflectTossPower, 5.0f},
+        {"ReflectUpperPunchScaleH", &PlayerConst::mReflectUpperPunchScaleH, 0.4f},
+        {"RollingAnimBorderSpeedMax", &PlayerConst::mRollingAnimBorderSpeedMax, 35.0f},
+        {"RollingAnimBorderSpeedMin", &PlayerConst::mRollingAnimBorderSpeedMin, 5.0f},
+        {"RollingAnimFrameRateMax", &PlayerConst::mRollingAnimFrameRateMax, 1.0f},
+        {"RollingAnimFrameRateMin", &PlayerConst::mRollingAnimFrameRateMin, 0.2f},
+        {"RoundAccelFrame", &PlayerConst::mRoundAccelFrame, 20},
+        {"RoundAccelFrameFast", &PlayerConst::mRoundAccelFrameFast, 5},
+        {"RoundAccelFrameForceFast", &PlayerConst::mRoundAccelFrameForceFast, 10},
+        {"RoundBrakeFrame", &PlayerConst::mRoundBrakeFrame, 20},
+        {"RoundBrakeFrameForce", &PlayerConst::mRoundBrakeFrameForce, 3},
+        {"RoundFastDegree", &PlayerConst::mRoundFastDegree, 45.0f},
+        {"RoundFastDegreeForce", &PlayerConst::mRoundFastDegreeForce, 45.0f},
+        {"RoundLimitDegree", &PlayerConst::mRoundLimitDegree, 8.5f},
+        {"RoundLimitDegreeForce", &PlayerConst::mRoundLimitDegreeForce, 4.0f},
+        {"RoundLimitDegreeForceFast", &PlayerConst::mRoundLimitDegreeForceFast, 4.0f},
+        {"RoundLimitDegreeMin", &PlayerConst::mRoundLimitDegreeMin, 6.5f},
+        {"RoundMinDegree", &PlayerConst::mRoundMinDegree, 0.5f},
+        {"RunAccelAverageScale", &PlayerConst::mRunAccelAverageScale, 0.5f},
+        {"RunAccelFrameContinuousThrow", &PlayerConst::mRunAccelFrameContinuousThrow, 60},
+        {"RunAfterTurnFrame", &PlayerConst::mRunAfterTurnFrame, 30},
+        {"RunAfterTurnScale", &PlayerConst::mRunAfterTurnScale, 0.5f},
+        {"RunAfterTurnSpeedMax", &PlayerConst::mRunAfterTurnSpeedMax, 17.0f},
+        {"RunBlendRange", &PlayerConst::mRunBlendRange, 2.0f},
+        {"RunBorderSpeed", &PlayerConst::mRunBorderSpeed, 8.0f},
+        {"RunDeepDownFrame", &PlayerConst::mRunDeepDownFrame, 10},
+        {"RunDeepDownMargine", &PlayerConst::mRunDeepDownMargine, 10},
+        {"RunSkateAnimSpeedOffset", &PlayerConst::mRunSkateAnimSpeedOffset, 5.0f},
+        {"RunSpeedMaxContinuousThrow", &PlayerConst::mRunSpeedMaxContinuousThrow, 16.0f},
+        {"RunStartBlendFrame", &PlayerConst::mRunStartBlendFrame, 5},
+        {"RunStartPlayFrameScale", &PlayerConst::mRunStartPlayFrameScale, 1.0f},
+        {"RunTimeContinuousThrow", &PlayerConst::mRunTimeContinuousThrow, 20},
+        {"SandSinkBorderMax", &PlayerConst::mSandSinkBorderMax, 0.5f},
+        {"SandSinkBorderMin", &PlayerConst::mSandSinkBorderMin, 0.0f},
+        {"SandSinkBorderRateMax", &PlayerConst::mSandSinkBorderRateMax, 0.5f},
+        {"SandSinkBorderRateMin", &PlayerConst::mSandSinkBorderRateMin, 0.0f},
+        {"SandSinkBrakeHeightH", &PlayerConst::mSandSinkBrakeHeightH, 100},
+        {"SandSinkBrakeHeightV", &PlayerConst::mSandSinkBrakeHeightV, 60},
+        {"SandSinkBrakeMaxH", &PlayerConst::mSandSinkBrakeMaxH, 0.1f},
+        {"SandSinkBrakeMaxV", &PlayerConst::mSandSinkBrakeMaxV, 0.1f},
+        {"SandSinkBrakeMinH", &PlayerConst::mSandSinkBrakeMinH, 0.6f},
+        {"SandSinkBrakeMinV", &PlayerConst::mSandSinkBrakeMinV, 1.0f},
+        {"SandSinkCapThrow", &PlayerConst::mSandSinkCapThrow, 30.0f},
+        {"SandSinkDeadTime", &PlayerConst::mSandSinkDeadTime, 240},
+        {"SandSinkFrameRateMax", &PlayerConst::mSandSinkFrameRateMax, 0.5f},
+        {"SandSinkFrameRateMin", &PlayerConst::mSandSinkFrameRateMin, 4.0f},
+        {"SandSinkHeight", &PlayerConst::mSandSinkHeight, 200.0f},
+        {"SeparateCheckHeight", &PlayerConst::mSeparateCheckHeight, 200.0f},
+        {"SeparateEnableThrowHeight", &PlayerConst::mSeparateEnableThrowHeight, 45.0f},
+        {"SeparateOffsetLerpRate", &PlayerConst::mSeparateOffsetLerpRate, 0.25f},
+        {"ShadowDropHeightScale", &PlayerConst::mShadowDropHeightScale, 1.2f},
+        {"ShadowDropLengthExtend", &PlayerConst::mShadowDropLengthExtend, 10000.0f},
+        {"ShadowDropLengthMax", &PlayerConst::mShadowDropLengthMax, 4000.0f},
+        {"ShadowDropLengthMin", &PlayerConst::mShadowDropLengthMin, 20.0f},
+        {"ShadowDropNormalAdd", &PlayerConst::mShadowDropNormalAdd, 300.0f},
+        {"SlerpQuatGrav", &PlayerConst::mSlerpQuatGrav, 0.4f},
+        {"SlerpQuatRate", &PlayerConst::mSlerpQuatRate, 0.15f},
+        {"SlerpQuatRateSpinAir", &PlayerConst::mSlerpQuatRateSpinAir, 0.1f},
+        {"SlerpQuatRateWait", &PlayerConst::mSlerpQuatRateWait, 0.15f},
+        {"SlideInvalidFrame", &PlayerConst::mSlideInvalidFrame, 15},
+        {"SlopeForceFrame", &PlayerConst::mSlopeForceFrame, 30},
+        {"SlopeRollingAccel", &PlayerConst::mSlopeRollingAccel, 0.6f},
+        {"SlopeRollingAccelOnSkate", &PlayerConst::mSlopeRollingAccelOnSkate, 0.9f},
+        {"SlopeRollingAgainst", &PlayerConst::mSlopeRollingAgainst, 0.5f},
+        {"SlopeRollingAnglePowerMax", &PlayerConst::mSlopeRollingAnglePowerMax, 30.0f},
+        {"SlopeRollingBrake", &PlayerConst::mSlopeRollingBrake, 0.998f},
+        {"SlopeRollingBrakeOnSkate", &PlayerConst::mSlopeRollingBrakeOnSkate, 0.999f},
+        {"SlopeRollingEndBrake", &PlayerConst::mSlopeRollingEndBrake, 0.95f},
+        {"SlopeRollingEndBrakeEndSpeed", &PlayerConst::mSlopeRollingEndBrakeEndSpeed, 10.0f},
+        {"SlopeRollingFrameMin", &PlayerConst::mSlopeRollingFrameMin, 45},
+        {"SlopeRollingFrameMinBoost", &PlayerConst::mSlopeRollingFrameMinBoost, 30},
+        {"SlopeRollingMaxSpeed", &PlayerConst::mSlopeRollingMaxSpeed, 35.0f},
+        {"SlopeRollingReStartAccel", &PlayerConst::mSlopeRollingReStartAccel, 6.0f},
+        {"SlopeRollingReStartCharge", &PlayerConst::mSlopeRollingReStartCharge, 40},
+        {"SlopeRollingReStartForce", &PlayerConst::mSlopeRollingReStartForce, 60},
+        {"SlopeRollingReStartInterval", &PlayerConst::mSlopeRollingReStartInterval, 15},
+        {"SlopeRollingReStartMaxAdd", &PlayerConst::mSlopeRollingReStartMaxAdd, 3.0f},
+        {"SlopeRollingReStartSwing", &PlayerConst::mSlopeRollingReStartSwing, 0},
+        {"SlopeRollingSideAccel", &PlayerConst::mSlopeRollingSideAccel, 0.4f},
+        {"SlopeRollingSideAccelOnSkate", &PlayerConst::mSlopeRollingSideAccelOnSkate, 0.6f},
+        {"SlopeRollingSideBrake", &PlayerConst::mSlopeRollingSideBrake, 0.985f},
+        {"SlopeRollingSideMaxSpeed", &PlayerConst::mSlopeRollingSideMaxSpeed, 10.0f},
+        {"SlopeRollingSpeedBoost", &PlayerConst::mSlopeRollingSpeedBoost, 30.0f},
+        {"SlopeRollingSpeedEnd", &PlayerConst::mSlopeRollingSpeedEnd, 17.0f},
+        {"SlopeRollingSpeedStart", &PlayerConst::mSlopeRollingSpeedStart, 20.0f},
+        {"SlopeRollingStartJumpPower", &PlayerConst::mSlopeRollingStartJumpPower, 12.0f},
+        {"SlopeRollingStartSlideSpeed", &PlayerConst::mSlopeRollingStartSlideSpeed, 1.0f},
+        {"SlopeRollingUnRollFrame", &PlayerConst::mSlopeRollingUnRollFrame, 5},
+        {"SlopeSlideAccel", &PlayerConst::mSlopeSlideAccel, 0.3f},
+        {"SlopeSlideAngleEnd", &PlayerConst::mSlopeSlideAngleEnd, 10.0f},
+        {"SlopeSlideAngleStart", &PlayerConst::mSlopeSlideAngleStart, 26.0f},
+        {"SlopeSlideBrake", &PlayerConst::mSlopeSlideBrake, 0.9f},
+        {"SlopeSlideForceSideAccel", &PlayerConst::mSlopeSlideForceSideAccel, 0.2f},
+        {"SlopeSlideForceSideBrake", &PlayerConst::mSlopeSlideForceSideBrake, 0.96f},
+        {"SlopeSlideForceSideMaxSpeed", &PlayerConst::mSlopeSlideForceSideMaxSpeed, 3.0f},
+        {"SlopeSlideForceTurnDegree", &PlayerConst::mSlopeSlideForceTurnDegree, 15.0f},
+        {"SlopeSlideMaxSpeed", &PlayerConst::mSlopeSlideMaxSpeed, 22.0f},
+        {"SlopeSlideSideAccel", &PlayerConst::mSlopeSlideSideAccel, 0.6f},
+        {"SlopeSlideSideBrake", &PlayerConst::mSlopeSlideSideBrake, 0.98f},
+        {"SlopeSlideSideMaxSpeed", &PlayerConst::mSlopeSlideSideMaxSpeed, 10.0f},
+        {"SlopeSlideSpeedEnd", &PlayerConst::mSlopeSlideSpeedEnd, 3.0f},
+        {"SlopeTurnDegree", &PlayerConst::mSlopeTurnDegree, 5.0f},
+        {"SpinAirJumpPower", &PlayerConst::mSpinAirJumpPower, 6.0f},
+        {"SpinAirSpeedMax", &PlayerConst::mSpinAirSpeedMax, 7.0f},
+        {"SpinAttackFrame", &PlayerConst::mSpinAttackFrame, 12},
+        {"SpinBrakeFrame", &PlayerConst::mSpinBrakeFrame, 15},
+        {"SpinBrakeRate", &PlayerConst::mSpinBrakeRate, 0.95f},
+        {"SpinBrakeSideAccel", &PlayerConst::mSpinBrakeSideAccel, 0.5f},
+        {"SpinBrakeSideBrakeRate", &PlayerConst::mSpinBrakeSideBrakeRate, 0.95f},
+        {"SpinBrakeSideMaxSpeedRate", &PlayerConst::mSpinBrakeSideMaxSpeedRate, 0.8f},
+        {"SpinCapThrowFrame", &PlayerConst::mSpinCapThrowFrame, 12},
+        {"SpinCapThrowFrameAir", &PlayerConst::mSpinCapThrowFrameAir, 8},
+        {"SpinCapThrowFrameContinuous", &PlayerConst::mSpinCapThrowFrameContinuous, 2},
+        {"SpinCapThrowFrameSwim", &PlayerConst::mSpinCapThrowFrameSwim, 12},
+        {"SpinCapThrowFrameSwing", &PlayerConst::mSpinCapThrowFrameSwing, 7},
+        {"SpinFlowerJumpDownFallInitSpeed", &PlayerConst::mSpinFlowerJumpDownFallInitSpeed, 15.0f},
+        {"SpinFlowerJumpDownFallPower", &PlayerConst::mSpinFlowerJumpDownFallPower, 2.0f},
+        {"SpinFlowerJumpDownFallSpeedMax", &PlayerConst::mSpinFlowerJumpDownFallSpeedMax, 30.0f},
+        {"SpinFlowerJumpFallSpeedMax", &PlayerConst::mSpinFlowerJumpFallSpeedMax, 8.0f},
+        {"SpinFlowerJumpGravity", &PlayerConst::mSpinFlowerJumpGravity, 0.1f},
+        {"SpinFlowerJumpMovePower", &PlayerConst::mSpinFlowerJumpMovePower, 1.0f},
+        {"SpinFlowerJumpNoInputBrake", &PlayerConst::mSpinFlowerJumpNoInputBrake, 0.95f},
+        {"SpinFlowerJumpStayFrame", &PlayerConst::mSpinFlowerJumpStayFrame, 80},
+        {"SpinFlowerJumpStaySpeedMax", &PlayerConst::mSpinFlowerJumpStaySpeedMax, 1.0f},
+        {"SpinFlowerJumpVelMax", &PlayerConst::mSpinFlowerJumpVelMax, 9.0f},
+        {"SpinJumpDownFallInitSpeed", &PlayerConst::mSpinJumpDownFallInitSpeed, 35.0f},
+        {"SpinJumpDownFallPower", &PlayerConst::mSpinJumpDownFallPower, 1.5f},
+        {"SpinJumpDownFallSpeedMax", &PlayerConst::mSpinJumpDownFallSpeedMax, 45.0f},
+        {"SpinJumpGravity", &PlayerConst::mSpinJumpGravity, 0.4f},
+        {"SpinJumpMoveSpeedMax", &PlayerConst::mSpinJumpMoveSpeedMax, 8.0f},
+        {"SpinJumpPower", &PlayerConst::mSpinJumpPower, 20.0f},
+        {"SpinRoundLimitDegree", &PlayerConst::mSpinRoundLimitDegree, 5.0f},
+        {"SquatAccelRate", &PlayerConst::mSquatAccelRate, 1.2f},
+        {"SquatBrakeEndSpeed", &PlayerConst::mSquatBrakeEndSpeed, 3.5f},
+        {"SquatBrakeRate", &PlayerConst::mSquatBrakeRate, 0.95f},
+        {"SquatBrakeRateOnSkate", &PlayerConst::mSquatBrakeRateOnSkate, 0.985f},
+        {"SquatBrakeSideAccel", &PlayerConst::mSquatBrakeSideAccel, 0.25f},
+        {"SquatBrakeSideAccelOnSkate", &PlayerConst::mSquatBrakeSideAccelOnSkate, 0.1f},
+        {"SquatBrakeSideMaxSpeedRate", &PlayerConst::mSquatBrakeSideMaxSpeedRate, 0.5f},
+        {"SquatBrakeSideRate", &PlayerConst::mSquatBrakeSideRate, 0.93f},
+        {"SquatBrakeSideRateOnSkate", &PlayerConst::mSquatBrakeSideRateOnSkate, 0.975f},
+        {"SquatJumpBackPower", &PlayerConst::mSquatJumpBackPower, 5.0f},
+        {"SquatJumpCeilSlideSpeed2D", &PlayerConst::mSquatJumpCeilSlideSpeed2D, 7.0f},
+        {"SquatJumpGravity", &PlayerConst::mSquatJumpGravity, 1.0f},
+        {"SquatJumpMovePowerFront", &PlayerConst::mSquatJumpMovePowerFront, 0.2f},
+        {"SquatJumpMovePowerSide", &PlayerConst::mSquatJumpMovePowerSide, 0.2f},
+        {"SquatJumpMoveSpeedMax", &PlayerConst::mSquatJumpMoveSpeedMax, 9.0f},
+        {"SquatJumpPower", &PlayerConst::mSquatJumpPower, 32.0f},
+        {"SquatWalkSpeed", &PlayerConst::mSquatWalkSpeed, 3.5f},
+        {"SquatWalkTurnFrame", &PlayerConst::mSquatWalkTurnFrame, 10},
+        {"SquatWalkTurnSpeed", &PlayerConst::mSquatWalkTurnSpeed, 30.0f},
+        {"StandAngleMax", &PlayerConst::mStandAngleMax, 70.0f},
+        {"StandAngleMin", &PlayerConst::mStandAngleMin, 60.0f},
+        {"StickOnBrakeFrame", &PlayerConst::mStickOnBrakeFrame, 120},
+        {"StickOnBrakeFrame2D", &PlayerConst::mStickOnBrakeFrame2D, 60},
+        {"SwimBentForwardBlendRate", &PlayerConst::mSwimBentForwardBlendRate, 0.05f},
+        {"SwimBentForwardMax", &PlayerConst::mSwimBentForwardMax, 30.0f},
+        {"SwimBentFrontBlendRate", &PlayerConst::mSwimBentFrontBlendRate, 0.04f},
+        {"SwimBentFrontMax", &PlayerConst::mSwimBentFrontMax, 45.0f},
+        {"SwimBentSideBlendRate", &PlayerConst::mSwimBentSideBlendRate, 0.05f},
+        {"SwimBentSideMax", &PlayerConst::mSwimBentSideMax, 60.0f},
+        {"SwimBentSpineMax", &PlayerConst::mSwimBentSpineMax, 40.0f},
+        {"SwimBrakeRateH", &PlayerConst::mSwimBrakeRateH, 0.975f},
+        {"SwimCenterOffset", &PlayerConst::mSwimCenterOffset, 80.0f},
+        {"SwimDiveBrake", &PlayerConst::mSwimDiveBrake, 0.875f},
+        {"SwimDiveButtonValidFrame", &PlayerConst::mSwimDiveButtonValidFrame, 10},
+        {"SwimDiveEndFrame", &PlayerConst::mSwimDiveEndFrame, 5},
+        {"SwimDiveEndSpeed", &PlayerConst::mSwimDiveEndSpeed, 1.25f},
+        {"SwimDiveInBrakeH", &PlayerConst::mSwimDiveInBrakeH, 0.97f},
+        {"SwimDiveInBrakeV", &PlayerConst::mSwimDiveInBrakeV, 0.987f},
+        {"SwimDiveInKeepFrame", &PlayerConst::mSwimDiveInKeepFrame, 10},
+        {"SwimDiveInRisePower", &PlayerConst::mSwimDiveInRisePower, 0.5f},
+        {"SwimDiveInRiseSpeedMax", &PlayerConst::mSwimDiveInRiseSpeedMax, 3.0f},
+        {"SwimDiveInSurfaceHeight", &PlayerConst::mSwimDiveInSurfaceHeight, 50.0f},
+        {"SwimDiveLandCancelFrame", &PlayerConst::mSwimDiveLandCancelFrame, 15},
+        {"SwimDiveLandCount", &PlayerConst::mSwimDiveLandCount, 0},
+        {"SwimDiveNoBrakeFrame", &PlayerConst::mSwimDiveNoBrakeFrame, 15},
+        {"SwimDiveStartSpeed", &PlayerConst::mSwimDiveStartSpeed, 26.5f},
+        {"SwimFallInBrakeH", &PlayerConst::mSwimFallInBrakeH, 0.95f},
+        {"SwimFallInBrakeV", &PlayerConst::mSwimFallInBrakeV, 0.91f},
+        {"SwimFallInForceSurfaceFrame", &PlayerConst::mSwimFallInForceSurfaceFrame, 10},
+        {"SwimFallInSpeed", &PlayerConst::mSwimFallInSpeed, 15.0f},
+        {"SwimFallInvalidJumpFrame", &PlayerConst::mSwimFallInvalidJumpFrame, 8},
+        {"SwimFallSpeedMax", &PlayerConst::mSwimFallSpeedMax, 6.5f},
+        {"SwimFloorAccelH", &PlayerConst::mSwimFloorAccelH, 0.125f},
+        {"SwimFloorSpeedMaxH", &PlayerConst::mSwimFloorSpeedMaxH, 6.5f},
+        {"SwimFlowFieldBlend", &PlayerConst::mSwimFlowFieldBlend, 0.776f},
+        {"SwimGravity", &PlayerConst::mSwimGravity, 0.25f},
+        {"SwimGravityWalk", &PlayerConst::mSwimGravityWalk, 1.0f},
+        {"SwimHeadInBrakeH", &PlayerConst::mSwimHeadInBrakeH, 0.98f},
+        {"SwimHeadInBrakeV", &PlayerConst::mSwimHeadInBrakeV, 0.92f},
+        {"SwimHeadInRisePower", &PlayerConst::mSwimHeadInRisePower, 0.6f},
+        {"SwimHeadInRiseSpeedMax", &PlayerConst::mSwimHeadInRiseSpeedMax, 10.0f},
+        {"SwimHeadInSurfaceHeight", &PlayerConst::mSwimHeadInSurfaceHeight, 50.0f},
+        {"SwimHeadSlidingBrake", &PlayerConst::mSwimHeadSlidingBrake, 0.0f},
+        {"SwimHeadSlidingBrakeFrame", &PlayerConst::mSwimHeadSlidingBrakeFrame, 45},
+        {"SwimHeadSlidingEndBrakeFrame", &PlayerConst::mSwimHeadSlidingEndBrakeFrame, 30},
+        {"SwimHeadSlidingEndSpeedMin", &PlayerConst::mSwimHeadSlidingEndSpeedMin, 5},
+        {"SwimHeadSlidingFrame", &PlayerConst::mSwimHeadSlidingFrame, 15},
+        {"SwimHeadSlidingGravity", &PlayerConst::mSwimHeadSlidingGravity, 0.0f},
+        {"SwimHeadSlidingJump", &PlayerConst::mSwimHeadSlidingJump, 0.0f},
+        {"SwimHeadSlidingSideAccel", &PlayerConst::mSwimHeadSlidingSideAccel, 0.125f},
+        {"SwimHeadSlidingSpeed", &PlayerConst::mSwimHeadSlidingSpeed, 15.0f},
+        {"SwimHeadSlidingSpeedEnd", &PlayerConst::mSwimHeadSlidingSpeedEnd, 10.0f},
+        {"SwimHighAccelH", &PlayerConst::mSwimHighAccelH, 0.25f},
+        {"SwimHighAccelPermitFrame", &PlayerConst::mSwimHighAccelPermitFrame, 35},
+        {"SwimHighSpeedMaxH", &PlayerConst::mSwimHighSpeedMaxH, 7.5f},
+        {"SwimJumpHipDropAccelH", &PlayerConst::mSwimJumpHipDropAccelH, 0.25f},
+        {"SwimJumpHipDropBrakeV", &PlayerConst::mSwimJumpHipDropBrakeV, 0.98f},
+        {"SwimJumpHipDropBrakeVCeiling", &PlayerConst::mSwimJumpHipDropBrakeVCeiling, 0.5f},
+        {"SwimJumpHipDropCancelSpeed", &PlayerConst::mSwimJumpHipDropCancelSpeed, 7.5f},
+        {"SwimJumpHipDropGravity", &PlayerConst::mSwimJumpHipDropGravity, 0.2f},
+        {"SwimJumpHipDropMoveSpeedH", &PlayerConst::mSwimJumpHipDropMoveSpeedH, 3.0f},
+        {"SwimJumpHipDropPopJumpAdd", &PlayerConst::mSwimJumpHipDropPopJumpAdd, 7.0f},
+        {"SwimJumpHipDropPopSpeed", &PlayerConst::mSwimJumpHipDropPopSpeed, 8.0f},
+        {"SwimJumpHipDropSpeed", &PlayerConst::mSwimJumpHipDropSpeed, 27.0f},
+        {"SwimLowAccelH", &PlayerConst::mSwimLowAccelH, 0.25f},
+        {"SwimLowSpeedMaxH", &PlayerConst::mSwimLowSpeedMaxH, 6.5f},
+        {"SwimPaddleAnimInterval", &PlayerConst::mSwimPaddleAnimInterval, 32},
+        {"SwimPaddleAnimMaxRate", &PlayerConst::mSwimPaddleAnimMaxRate, 3.0f},
+        {"SwimPaddleAnimRateIntervalMax", &PlayerConst::mSwimPaddleAnimRateIntervalMax, 22},
+        {"SwimPaddleAnimRateIntervalMin", &PlayerConst::mSwimPaddleAnimRateIntervalMin, 5},
+        {"SwimRiseFrame", &PlayerConst::mSwimRiseFrame, 10},
+        {"SwimRisePower", &PlayerConst::mSwimRisePower, 0.6f},
+        {"SwimRiseSpeedMax", &PlayerConst::mSwimRiseSpeedMax, 7.5f},
+        {"SwimRotAccelFrame", &PlayerConst::mSwimRotAccelFrame, 20},
+        {"SwimRotAccelFrameFast", &PlayerConst::mSwimRotAccelFrameFast, 1},
+        {"SwimRotBrakeFrame", &PlayerConst::mSwimRotBrakeFrame, 30},
+        {"SwimRotFastAngle", &PlayerConst::mSwimRotFastAngle, 80.0f},
+        {"SwimRotSpeedChangeStart", &PlayerConst::mSwimRotSpeedChangeStart, 3.0f},
+        {"SwimRotSpeedForward", &PlayerConst::mSwimRotSpeedForward, 3.0f},
+        {"SwimRotSpeedMax", &PlayerConst::mSwimRotSpeedMax, 7.5f},
+        {"SwimRotStartAngle", &PlayerConst::mSwimRotStartAngle, 1.0f},
+        {"SwimRunSurfaceApproachBorderMax", &PlayerConst::mSwimRunSurfaceApproachBorderMax, 38.0f},
+        {"SwimRunSurfaceApproachBorderMin", &PlayerConst::mSwimRunSurfaceApproachBorderMin, 30.0f},
+        {"SwimRunSurfaceApproachLimit", &PlayerConst::mSwimRunSurfaceApproachLimit, 5.0f},
+        {"SwimRunSurfaceApproachRate", &PlayerConst::mSwimRunSurfaceApproachRate, 0.5f},
+        {"SwimRunSurfaceApproachRateMin", &PlayerConst::mSwimRunSurfaceApproachRateMin, 0.06f},
+        {"SwimRunSurfaceBaseHeight", &PlayerConst::mSwimRunSurfaceBaseHeight, 0.0f},
+        {"SwimRunSurfaceBrakeBorder", &PlayerConst::mSwimRunSurfaceBrakeBorder, 35.0f},
+        {"SwimRunSurfaceBrakeH", &PlayerConst::mSwimRunSurfaceBrakeH, 0.995f},
+        {"SwimSpinCapUpPower", &PlayerConst::mSwimSpinCapUpPower, 10.0f},
+        {"SwimSpinCapUpSpeedMax", &PlayerConst::mSwimSpinCapUpSpeedMax, 4.5f},
+        {"SwimSurfaceAccelH", &PlayerConst::mSwimSurfaceAccelH, 0.25f},
+        {"SwimSurfaceBaseHeight", &PlayerConst::mSwimSurfaceBaseHeight, 80.0f},
+        {"SwimSurfaceDamper", &PlayerConst::mSwimSurfaceDamper, 0.949f},
+        {"SwimSurfaceDamperFrame", &PlayerConst::mSwimSurfaceDamperFrame, 25},
+        {"SwimSurfaceDamperStart", &PlayerConst::mSwimSurfaceDamperStart, 25},
+        {"SwimSurfaceEnableJumpHeight", &PlayerConst::mSwimSurfaceEnableJumpHeight, 160.0f},
+        {"SwimSurfaceEndDist", &PlayerConst::mSwimSurfaceEndDist, 200.0f},
+        {"SwimSurfaceGravity", &PlayerConst::mSwimSurfaceGravity, 0.125f},
+        {"SwimSurfaceMoveBaseHeight", &PlayerConst::mSwimSurfaceMoveBaseHeight, 80.0f},
+        {"SwimSurfaceMoveDamper", &PlayerConst::mSwimSurfaceMoveDamper, 0.94f},
+        {"SwimSurfaceMoveSpring", &PlayerConst::mSwimSurfaceMoveSpring, 0.01f},
+        {"SwimSurfacePreInputJumpFrame", &PlayerConst::mSwimSurfacePreInputJumpFrame, 8},
+        {"SwimSurfaceSpeedMaxH", &PlayerConst::mSwimSurfaceSpeedMaxH, 9.0f},
+        {"SwimSurfaceSpinCapFrame", &PlayerConst::mSwimSurfaceSpinCapFrame, 45},
+        {"SwimSurfaceSpinCapSpeedMaxH", &PlayerConst::mSwimSurfaceSpinCapSpeedMaxH, 13.0f},
+        {"SwimSurfaceSpring", &PlayerConst::mSwimSurfaceSpring, 0.05f},
+        {"SwimSurfaceStartDist", &PlayerConst::mSwimSurfaceStartDist, 120.0f},
+        {"SwimTramplePower", &PlayerConst::mSwimTramplePower, 8.0f},
+        {"SwimWalkAnimFrameRateMax", &PlayerConst::mSwimWalkAnimFrameRateMax, 1.75f},
+        {"SwimWalkAnimFrameRateMin", &PlayerConst::mSwimWalkAnimFrameRateMin, 0.5f},
+        {"SwimWalkAnimMaxRate", &PlayerConst::mSwimWalkAnimMaxRate, 1.9f},
+        {"SwimWalkAnimMinRate", &PlayerConst::mSwimWalkAnimMinRate, 0.2f},
+        {"SwimWalkAnimSpeedMax", &PlayerConst::mSwimWalkAnimSpeedMax, 6.5f},
+        {"SwimWalkAnimSpeedMin", &PlayerConst::mSwimWalkAnimSpeedMin, 1.0f},
+        {"SwimWalkMaxSpeed", &PlayerConst::mSwimWalkMaxSpeed, 5.0f},
+        {"SwimWallCatchOffset", &PlayerConst::mSwimWallCatchOffset, 100.0f},
+        {"SwimWallHitSpeedMinH", &PlayerConst::mSwimWallHitSpeedMinH, 3.0f},
+        {"Tall", &PlayerConst::mTall, 160.0f},
+        {"TiltEyeAngleScale", &PlayerConst::mTiltEyeAngleScale, 0.4f},
+        {"TiltEyeBorderEnd", &PlayerConst::mTiltEyeBorderEnd, 0.25f},
+        {"TiltEyeBorderStart", &PlayerConst::mTiltEyeBorderStart, 0.9f},
+        {"TiltPoseDegreeMax", &PlayerConst::mTiltPoseDegreeMax, 20.0f},
+        {"TrampleGravity", &PlayerConst::mTrampleGravity, 1.75f},
+        {"TrampleGravity2D", &PlayerConst::mTrampleGravity2D, 1.75f},
+        {"TrampleHighGravity", &PlayerConst::mTrampleHighGravity, 1.0f},
+        {"TrampleHighGravity2D", &PlayerConst::mTrampleHighGravity2D, 1.0f},
+        {"TrampleHighJumpPower", &PlayerConst::mTrampleHighJumpPower, 25.0f},
+        {"TrampleHighJumpPower2D", &PlayerConst::mTrampleHighJumpPower2D, 32.0f},
+        {"TrampleHipDropGravity", &PlayerConst::mTrampleHipDropGravity, 1.5f},
+        {"TrampleHipDropJumpPower", &PlayerConst::mTrampleHipDropJumpPower, 35.0f},
+        {"TrampleJumpCodePower", &PlayerConst::mTrampleJumpCodePower, 57.0f},
+        {"TrampleJumpCodePowerSmall", &PlayerConst::mTrampleJumpCodePowerSmall, 35.0f},
+        {"TrampleJumpPower", &PlayerConst::mTrampleJumpPower, 20.0f},
+        {"TrampleJumpPower2D", &PlayerConst::mTrampleJumpPower2D, 20.0f},
+        {"TrampleRisingBrakeVelH", &PlayerConst::mTrampleRisingBrakeVelH, 0.3f},
+        {"TurnEndSpeedRate2D", &PlayerConst::mTurnEndSpeedRate2D, 1.0f},
+        {"TurnJumpAccel", &PlayerConst::mTurnJumpAccel, 0.25f},
+        {"TurnJumpBrake", &PlayerConst::mTurnJumpBrake, 0.5f},
+        {"TurnJumpGravity", &PlayerConst::mTurnJumpGravity, 1.0f},
+        {"TurnJumpPower", &PlayerConst::mTurnJumpPower, 32.0f},
+        {"TurnJumpSideAccel", &PlayerConst::mTurnJumpSideAccel, 0.075f},
+        {"TurnJumpVelH", &PlayerConst::mTurnJumpVelH, 9.0f},
+        {"WaitPoseDegreeMax", &PlayerConst::mWaitPoseDegreeMax, 45.0f},
+        {"WallCatchDegree", &PlayerConst::mWallCatchDegree, 43.0f},
+        {"WallCatchHeightBottom", &PlayerConst::mWallCatchHeightBottom, 150.0f},
+        {"WallCatchHeightEdgeTop", &PlayerConst::mWallCatchHeightEdgeTop, 120.0f},
+        {"WallCatchHipFriction", &PlayerConst::mWallCatchHipFriction, 0.9f},
+        {"WallCatchHipLimitDegree", &PlayerConst::mWallCatchHipLimitDegree, 75.0f},
+        {"WallCatchHipLocalOffset", &PlayerConst::mWallCatchHipLocalOffset, 100.0f},
+        {"WallCatchHipStability", &PlayerConst::mWallCatchHipStability, 0.1f},
+        {"WallCatchInputRepeatAngle", &PlayerConst::mWallCatchInputRepeatAngle, 30.0f},
+        {"WallCatchKeepDegree", &PlayerConst::mWallCatchKeepDegree, 45.0f},
+        {"WallCatchMoveDegree", &PlayerConst::mWallCatchMoveDegree, 40.0f},
+        {"WallCatchMoveFrame", &PlayerConst::mWallCatchMoveFrame, 10},
+        {"WallCatchMoveFrameFast", &PlayerConst::mWallCatchMoveFrameFast, 8},
+        {"WallCatchMoveFrameSwing", &PlayerConst::mWallCatchMoveFrameSwing, 6},
+        {"WallCatchMoveHeightRange", &PlayerConst::mWallCatchMoveHeightRange, 70.0f},
+        {"WallCatchMoveInterpolate", &PlayerConst::mWallCatchMoveInterpolate, 10},
+        {"WallCatchMoveSpeed", &PlayerConst::mWallCatchMoveSpeed, 70.0f},
+        {"WallCatchStainAreaOffset", &PlayerConst::mWallCatchStainAreaOffset, 100.0f},
+        {"WallClimbDegree", &PlayerConst::mWallClimbDegree, 40.0f},
+        {"WallClimbGravity", &PlayerConst::mWallClimbGravity, 15.0f},
+        {"WallClimbJumpEndFrame", &PlayerConst::mWallClimbJumpEndFrame, 30},
+        {"WallClimbJumpGravity", &PlayerConst::mWallClimbJumpGravity, 1.5f},
+        {"WallClimbJumpInvalidFrame", &PlayerConst::mWallClimbJumpInvalidFrame, 12},
+        {"WallClimbJumpSpeedH", &PlayerConst::mWallClimbJumpSpeedH, 3.0f},
+        {"WallClimbJumpSpeedV", &PlayerConst::mWallClimbJumpSpeedV, 20.0f},
+        {"WallClimbJumpStartFrame", &PlayerConst::mWallClimbJumpStartFrame, 5},
+        {"WallClimbStartFrame", &PlayerConst::mWallClimbStartFrame, 20},
+        {"WallFallJumpSpeed", &PlayerConst::mWallFallJumpSpeed, 12.0f},
+        {"WallFollowAngleH", &PlayerConst::mWallFollowAngleH, 20.0f},
+        {"WallFollowAngleV", &PlayerConst::mWallFollowAngleV, 30.0f},
+        {"WallHeightLowLimit", &PlayerConst::mWallHeightLowLimit, 120.0f},
+        {"WallInhibitAfterPunch", &PlayerConst::mWallInhibitAfterPunch, 10},
+        {"WallJumpGravity", &PlayerConst::mWallJumpGravity, 0.95f},
+        {"WallJumpHSpeed", &PlayerConst::mWallJumpHSpeed, 8.6f},
+        {"WallJumpInvalidateInputFrame", &PlayerConst::mWallJumpInvalidateInputFrame, 25},
+        {"WallJumpPower", &PlayerConst::mWallJumpPower, 23.0f},
+        {"WallKeepDegree", &PlayerConst::mWallKeepDegree, 60.0f},
+        {"WallKeepFrame", &PlayerConst::mWallKeepFrame, 3},
+        {"WallPushFrame", &PlayerConst::mWallPushFrame, 15},
+    };
+    static_assert(al::isSortedByamlSchema(cSchema));
+
+    al::readByamlSchema(this, byaml, cSchema);
+}
+#else
 PlayerConst::PlayerConst(const al::ByamlIter& byaml) {
     mGravity = 3.0;
     byaml.tryGetFloatByKey(&mGravity, "Gravity");
@@ -1850,6 +2479,7 @@ PlayerConst::PlayerConst(const al::ByamlIter& byaml) {
     mAdditionalSpeedLimit = 30.0;
     byaml.tryGetFloatByKey(&mAdditionalSpeedLimit, "AdditionalSpeedLimit");
 }
+#endif
 
 f32 PlayerConst::getGravity() const {
     return mGravity;
@@ -3,6 +3,10 @@
 #include "Library/Yaml/ByamlUtil.h"
 #include "Library/Yaml/Writer/ByamlWriter.h"
 
+#ifdef AL_BYAML_SCHEMA
+#include "Library/Yaml/ByamlSchema.h"
+#endif
+
 void GameConfigData::init() {
     mCameraStickSensitivityLevel = -1;
     mIsCameraReverseInputH = false;
@@ -111,6 +115,26 @@ void GameConfigData::write(al::ByamlWriter* writer) {
     writer->pop();
 }
 
+#ifdef AL_BYAML_SCHEMA
+// NON_MATCHING: reads through a key index schema instead of one tryGetByaml* per member
+void GameConfigData::read(const al::ByamlIter& conf) {
+    static constexpr al::ByamlSchemaField<GameConfigData> cSchema[] = {
+        {"CameraGyroSensitivityLevel", &GameConfigData::mCameraGyroSensitivityLevel, -1},
+        {"CameraStickSensitivityLevel", &GameConfigData::mCameraStickSensitivityLevel, -1},
+        {"IsCameraReverseInputH", &GameConfigData::mIsCameraReverseInputH, false},
+        {"IsCameraReverseInputV", &GameConfigData::mIsCameraReverseInputV, false},
+        {"IsPadRumble", &GameConfigData::mIsValidPadRumble, true},
+        {"IsUseOpenListAdditionalButton", &GameConfigData::mIsUseOpenListAdditionalButton, false},
+        {"IsValidCameraGyro", &GameConfigData::mIsValidCameraGyro, true},
+        {"PadRumbleLevel", &GameConfigData::mPadRumbleLevel, 0},
+    };
+    static_assert(al::isSortedByamlSchema(cSchema));
+
+    al::ByamlIter iter;
+    al::tryGetByamlIterByKey(&iter, conf, "GameConfigData");
+    al::readByamlSchema(this, iter, cSchema);
+}
+#else
 void GameConfigData::read(const al::ByamlIter& conf) {
     mCameraStickSensitivityLevel = -1;
     mIsCameraReverseInputH = false;
@@ -132,3 +156,4 @@ void GameConfigData::read(const al::ByamlIter& conf) {
     al::tryGetByamlBool(&mIsValidPadRumble, iter, "IsPadRumble");
     al::tryGetByamlS32(&mPadRumbleLevel, iter, "PadRumbleLevel");
 }
+#endif
@@ -0,0 +1,93 @@
+#include "BenchmarkReport.h"
+
+#include <chrono>
+#include <cstdio>
+
+namespace al {
+
+s64 getBenchmarkNanoSeconds() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+void BenchmarkReport::beginSuite(const char* name) {
+    mSuiteName = name;
+    mChecks.clear();
+    mResults.clear();
+}
+
+void BenchmarkReport::endSuite() {
+    if (!mSuites.empty())
+        mSuites += ",";
+    mSuites += "\n{\"name\":\"";
+    mSuites += mSuiteName;
+    mSuites += "\",\"checks\":[" + mChecks + "],\"results\":[" + mResults + "\n]}";
+    mSuiteName = nullptr;
+}
+
+void BenchmarkReport::beginResult() {
+    if (!mResults.empty())
+        mResults += ",";
+    mResults += "\n{";
+    mIsFirstField = true;
+}
+
+void BenchmarkReport::endResult() {
+    mResults += "}";
+}
+
+void BenchmarkReport::addKey(const char* key) {
+    if (!mIsFirstField)
+        mResults += ",";
+    mResults += "\"";
+    mResults += key;
+    mResults += "\":";
+    mIsFirstField = false;
+}
+
+void BenchmarkReport::addInt(const char* key, s64 value) {
+    addKey(key);
+    mResults += std::to_string(value);
+}
+
+void BenchmarkReport::addFloat(const char* key, f64 value) {
+    char text[32];
+    snprintf(text, sizeof(text), "%.3f", value);
+    addKey(key);
+    mResults += text;
+}
+
+void BenchmarkReport::addBool(const char* key, bool value) {
+    addKey(key);
+    mResults += value ? "true" : "false";
+}
+
+void BenchmarkReport::addString(const char* key, const char* value) {
+    addKey(key);
+    mResults += "\"";
+    mResults += value;
+    mResults += "\"";
+}
+
+void BenchmarkReport::check(const char* name, bool isPassed) {
+    if (!mChecks.empty())
+        mChecks += ",";
+    mChecks += "{\"name\":\"";
+    mChecks += name;
+    mChecks += isPassed ? "\",\"isPassed\":true}" : "\",\"isPassed\":false}";
+
+    mCheckNum++;
+    if (isPassed)
+        return;
+    mFailedCheckNum++;
+    fprintf(stderr, "%s: check %s failed\n", mSuiteName, name);
+}
+
+std::string BenchmarkReport::createJson() const {
+    return "{\"checkNum\":" + std::to_string(mCheckNum) +
+           ",\"failedCheckNum\":" + std::to_string(mFailedCheckNum) + ",\"suites\":[" + mSuites +
+           "\n]}\n";
+}
+
+}  // namespace al
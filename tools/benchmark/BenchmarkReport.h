@@ -0,0 +1,45 @@
+#pragma once
+
+#include <basis/seadTypes.h>
+#include <string>
+
+namespace al {
+
+s64 getBenchmarkNanoSeconds();
+
+// Collects the results of all suites into one JSON document, and the checks that compare the
+// optimized code against its reference. A suite is an object with its name, its checks and a list
+// of results, each result one object of numbers, strings and bools.
+class BenchmarkReport {
+public:
+    void beginSuite(const char* name);
+    void endSuite();
+    void beginResult();
+    void endResult();
+    void addInt(const char* key, s64 value);
+    void addFloat(const char* key, f64 value);
+    void addBool(const char* key, bool value);
+    void addString(const char* key, const char* value);
+
+    // Failed checks are printed right away and make the benchmark end with a failure.
+    void check(const char* name, bool isPassed);
+
+    s32 getCheckNum() const { return mCheckNum; }
+
+    s32 getFailedCheckNum() const { return mFailedCheckNum; }
+
+    std::string createJson() const;
+
+private:
+    void addKey(const char* key);
+
+    std::string mSuites;
+    std::string mChecks;
+    std::string mResults;
+    const char* mSuiteName = nullptr;
+    bool mIsFirstField = true;
+    s32 mCheckNum = 0;
+    s32 mFailedCheckNum = 0;
+};
+
+}  // namespace al
@@ -0,0 +1,15 @@
+#pragma once
+
+namespace sead {
+class Heap;
+}  // namespace sead
+
+namespace al {
+class BenchmarkReport;
+
+// Quick runs use small data and few repeats, enough for the checks.
+void runByamlBenchmark(BenchmarkReport* report, sead::Heap* heap, bool isQuick);
+void runKCollisionBenchmark(BenchmarkReport* report, bool isQuick);
+void runSensorBenchmark(BenchmarkReport* report, bool isQuick);
+
+}  // namespace al
@@ -0,0 +1,547 @@
+#include <cstdio>
+#include <cstring>
+#include <heap/seadHeap.h>
+#include <heap/seadHeapMgr.h>
+#include <stream/seadRamStream.h>
+
+#include "Library/Yaml/ByamlData.h"
+#include "Library/Yaml/ByamlHeader.h"
+#include "Library/Yaml/ByamlIter.h"
+#include "Library/Yaml/ByamlKeyHandle.h"
+#include "Library/Yaml/Writer/ByamlWriter.h"
+
+#include "BenchmarkReport.h"
+#include "Benchmarks.h"
+
+namespace al {
+namespace {
+const char* const cUnitConfigNames[] = {
+    "Kuribo",  "Coin",      "Block",       "BlockQuestion", "TreasureBox", "Pukupuku",
+    "Karon",   "Senobi",    "Killer",      "Gabon",         "CapSwitch",   "WarpPoint",
+    "Moon",    "CoinStack", "ShineTowerB", "Tree",          "Bush",        "MoveLift",
+};
+constexpr s32 cUnitConfigNameNum = sizeof(cUnitConfigNames) / sizeof(cUnitConfigNames[0]);
+
+// Parameters of placement entries, every entry carries about half of them.
+const char* const cParamKeys[] = {
+    "CameraId",      "ClippingGroupId",   "IsConnectToCollision", "IsLinkDest",
+    "LayerConfigName", "MoveType",        "PlacementFileName",    "ShadowLength",
+    "SrcUnitLayerList", "Speed",          "WaitTime",             "Distance",
+    "AngleDegree",   "ViewId",            "SwitchAppear",         "SwitchKill",
+    "SwitchStart",   "ShapeType",         "IsValidSpotLight",     "ModelId",
+    "RailMoveSpeed", "IsAutoStart",       "DisappearTime",        "Variation",
+};
+constexpr s32 cParamKeyNum = sizeof(cParamKeys) / sizeof(cParamKeys[0]);
+
+// Keys looked up per entry, as an actor init reads them. "IsOnlyHard" is in no entry.
+ByamlKeyHandle sLookupKeys[] = {"Id",           "UnitConfigName", "Translate", "Rotate",
+                                "Scale",        "ShadowLength",   "MoveType",  "Speed",
+                                "SwitchAppear", "IsOnlyHard"};
+constexpr s32 cLookupKeyNum = sizeof(sLookupKeys) / sizeof(sLookupKeys[0]);
+
+const char* const cCorpusNames[] = {"deepPlacement", "wideHash", "largeStringTable"};
+constexpr s32 cCorpusNum = sizeof(cCorpusNames) / sizeof(cCorpusNames[0]);
+
+// Children per Links entry and levels of Links below every ObjectList entry of deepPlacement.
+constexpr s32 cLinkChildNum = 2;
+constexpr s32 cLinkDepth = 3;
+
+f64 calcNanoSecondsPerCount(s64 nanoSeconds, s64 count) {
+    return count == 0 ? 0.0 : (f64)nanoSeconds / count;
+}
+
+u32 mixHash(u32 hash, u32 value) {
+    return (hash ^ value) * 16777619;
+}
+
+void addVector(ByamlWriter* writer, const char* key, f32 x, f32 y, f32 z) {
+    writer->pushHash(key);
+    writer->addFloat("X", x);
+    writer->addFloat("Y", y);
+    writer->addFloat("Z", z);
+    writer->pop();
+}
+
+// {"ObjectList": [...]} with one hash per entry, shaped like the placement entries of a stage.
+void writeStageData(ByamlWriter* writer, s32 objectNum) {
+    writer->pushHash();
+    writer->pushArray("ObjectList");
+    for (s32 i = 0; i < objectNum; i++) {
+        char id[16];
+        snprintf(id, sizeof(id), "obj%d", i);
+
+        writer->pushHash();
+        writer->addString("Id", id);
+        writer->addString("UnitConfigName", cUnitConfigNames[i % cUnitConfigNameNum]);
+        addVector(writer, "Translate", i * 100.0f, (i % 7) * 50.0f, -i * 25.0f);
+        addVector(writer, "Rotate", 0.0f, (i % 360) * 1.0f, 0.0f);
+        addVector(writer, "Scale", 1.0f, 1.0f, 1.0f);
+        writer->pushHash("Links");
+        writer->pop();
+        for (s32 j = 0; j < cParamKeyNum; j++) {
+            if ((i + j) % 2 != 0)
+                continue;
+            if (j % 3 == 0)
+                writer->addInt(cParamKeys[j], i + j);
+            else if (j % 3 == 1)
+                writer->addFloat(cParamKeys[j], (i + j) * 0.5f);
+            else
+                writer->addBool(cParamKeys[j], (i & 1) != 0);
+        }
+        writer->pop();
+    }
+    writer->pop();
+    writer->pop();
+}
+
+void writePlacementEntry(ByamlWriter* writer, s32 index, s32 depth) {
+    char id[24];
+    snprintf(id, sizeof(id), "obj%d_%d", index, depth);
+
+    writer->pushHash();
+    writer->addString("Id", id);
+    writer->addString("UnitConfigName", depth == 0 ? "Kuribo" : "KuriboLink");
+    addVector(writer, "Translate", index * 100.0f, depth * 50.0f, -index * 25.0f);
+    addVector(writer, "Rotate", 0.0f, (index % 360) * 1.0f, 0.0f);
+    addVector(writer, "Scale", 1.0f, 1.0f, 1.0f);
+    writer->addInt("ClippingGroupId", -1);
+    writer->addBool("IsLinkDest", depth != 0);
+    writer->pushHash("Links");
+    if (depth < cLinkDepth) {
+        writer->pushArray("Child");
+        for (s32 i = 0; i < cLinkChildNum; i++)
+            writePlacementEntry(writer, index * cLinkChildNum + i, depth + 1);
+        writer->pop();
+    }
+    writer->pop();
+    writer->pop();
+}
+
+// {"ObjectList": [...]} where every entry carries a tree of linked entries under "Links".
+void writeDeepPlacement(ByamlWriter* writer, s32 scale) {
+    writer->pushHash();
+    writer->pushArray("ObjectList");
+    for (s32 i = 0; i < scale; i++)
+        writePlacementEntry(writer, i, 0);
+    writer->pop();
+    writer->pop();
+}
+
+// One hash with scale * 8 keys of every value type, including 64 bit values.
+void writeWideHash(ByamlWriter* writer, s32 scale) {
+    writer->pushHash();
+    for (s32 i = 0; i < scale * 8; i++) {
+        char key[24];
+        snprintf(key, sizeof(key), "Param%06d", i);
+        switch (i % 6) {
+        case 0:
+            writer->addInt(key, i);
+            break;
+        case 1:
+            writer->addFloat(key, i * 0.25f);
+            break;
+        case 2:
+            writer->addBool(key, (i & 1) != 0);
+            break;
+        case 3:
+            writer->addString(key, (i & 2) != 0 ? "On" : "Off");
+            break;
+        case 4:
+            writer->addInt64(key, (s64)i << 33);
+            break;
+        case 5:
+            writer->addDouble(key, i * 0.125);
+            break;
+        }
+    }
+    writer->pop();
+}
+
+// {"Messages": [...], "Labels": {...}} with scale * 8 unique string values.
+void writeLargeStringTable(ByamlWriter* writer, s32 scale) {
+    char text[48];
+    writer->pushHash();
+    writer->pushArray("Messages");
+    for (s32 i = 0; i < scale * 4; i++) {
+        snprintf(text, sizeof(text), "StageMessage_%06d_ShineGet", i);
+        writer->addString(text);
+    }
+    writer->pop();
+    writer->pushHash("Labels");
+    for (s32 i = 0; i < scale * 4; i++) {
+        char key[24];
+        snprintf(key, sizeof(key), "Label%06d", i);
+        snprintf(text, sizeof(text), "LabelText_%06d", i);
+        writer->addString(key, text);
+    }
+    writer->pop();
+    writer->pop();
+}
+
+void writeCorpus(ByamlWriter* writer, s32 corpus, s32 scale) {
+    if (corpus == 0)
+        writeDeepPlacement(writer, scale);
+    else if (corpus == 1)
+        writeWideHash(writer, scale);
+    else
+        writeLargeStringTable(writer, scale);
+}
+
+u8* createData(u32* size, sead::Heap* heap, ByamlWriter* writer) {
+    *size = writer->calcPackSize();
+    u8* data = static_cast<u8*>(heap->tryAlloc(*size, 4));
+    if (!data)
+        return nullptr;
+
+    sead::RamWriteStream stream(data, *size, sead::Stream::Modes::Binary);
+    writer->write(&stream);
+    return data;
+}
+
+// Reads every value of the tree through the same calls actors use, and hashes what it read.
+u32 walkTree(const ByamlIter& iter, u32 hash) {
+    s32 size = iter.getSize();
+    for (s32 i = 0; i < size; i++) {
+        ByamlData data;
+        if (!iter.getByamlDataByIndex(&data, i))
+            continue;
+
+        hash = mixHash(hash, data.getType());
+        switch (data.getType()) {
+        case ByamlDataType::TYPE_ARRAY:
+        case ByamlDataType::TYPE_HASH: {
+            ByamlIter child;
+            if (iter.tryConvertIter(&child, &data))
+                hash = walkTree(child, hash);
+            break;
+        }
+        case ByamlDataType::TYPE_STRING: {
+            const char* string = nullptr;
+            if (iter.tryConvertString(&string, &data))
+                hash = mixHash(hash, strlen(string));
+            break;
+        }
+        case ByamlDataType::TYPE_BOOL: {
+            bool value = false;
+            iter.tryConvertBool(&value, &data);
+            hash = mixHash(hash, value);
+            break;
+        }
+        case ByamlDataType::TYPE_INT: {
+            s32 value = 0;
+            iter.tryConvertInt(&value, &data);
+            hash = mixHash(hash, value);
+            break;
+        }
+        case ByamlDataType::TYPE_UINT: {
+            u32 value = 0;
+            iter.tryConvertUInt(&value, &data);
+            hash = mixHash(hash, value);
+            break;
+        }
+        case ByamlDataType::TYPE_FLOAT: {
+            f32 value = 0.0f;
+            u32 bits = 0;
+            iter.tryConvertFloat(&value, &data);
+            memcpy(&bits, &value, sizeof(bits));
+            hash = mixHash(hash, bits);
+            break;
+        }
+        case ByamlDataType::TYPE_LONG:
+        case ByamlDataType::TYPE_ULONG:
+        case ByamlDataType::TYPE_DOUBLE: {
+            u64 value = 0;
+            if (data.getType() == ByamlDataType::TYPE_DOUBLE) {
+                f64 value_f64 = 0.0;
+                iter.tryConvertDouble(&value_f64, &data);
+                memcpy(&value, &value_f64, sizeof(value));
+            } else {
+                iter.tryConvertUInt64(&value, &data);
+            }
+            hash = mixHash(mixHash(hash, (u32)value), (u32)(value >> 32));
+            break;
+        }
+        default:
+            break;
+        }
+    }
+    return hash;
+}
+
+// Containers and hash keys of one file, collected once so that only the lookups are timed.
+struct CorpusIndex {
+    ByamlIter* containers;
+    s32 containerNum;
+    const char** keys;
+    s32* keyContainers;
+    s32 keyNum;
+    s32 indexReadNum;
+};
+
+// With null arrays only counts.
+void collectTree(CorpusIndex* index, const ByamlIter& iter) {
+    s32 container = index->containerNum++;
+    if (index->containers)
+        index->containers[container] = iter;
+
+    s32 size = iter.getSize();
+    index->indexReadNum += size;
+    for (s32 i = 0; i < size; i++) {
+        ByamlData data;
+        if (iter.isTypeHash()) {
+            const char* key = nullptr;
+            if (!iter.getByamlDataAndKeyName(&data, &key, i))
+                continue;
+            if (index->keys) {
+                index->keys[index->keyNum] = key;
+                index->keyContainers[index->keyNum] = container;
+            }
+            index->keyNum++;
+        } else if (!iter.getByamlDataByIndex(&data, i)) {
+            continue;
+        }
+
+        ByamlIter child;
+        if (iter.tryConvertIter(&child, &data))
+            collectTree(index, child);
+    }
+}
+
+// Looks up the same keys in the same entries by key string and through ByamlKeyHandle. Entries
+// are fetched up front, so only the lookups are timed.
+void measureKeyLookup(BenchmarkReport* report, sead::Heap* heap, const u8* data,
+                      s32 repeatNum) {
+    ByamlIter root(data);
+    ByamlIter object_list;
+    root.tryGetIterByKey(&object_list, "ObjectList");
+    s32 object_num = object_list.getSize();
+
+    ByamlIter* objects = nullptr;
+    {
+        sead::ScopedCurrentHeapSetter setter{heap};
+        objects = new ByamlIter[object_num];
+    }
+    for (s32 i = 0; i < object_num; i++)
+        object_list.tryGetIterByIndex(&objects[i], i);
+
+    u32 key_sum = 0;
+    s64 begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++) {
+        for (s32 i = 0; i < object_num; i++) {
+            for (s32 k = 0; k < cLookupKeyNum; k++) {
+                ByamlData value;
+                if (objects[i].getByamlDataByKey(&value, sLookupKeys[k].getKey()))
+                    key_sum += value.getValue() + k;
+            }
+        }
+    }
+    s64 key_time = getBenchmarkNanoSeconds() - begin;
+
+    for (s32 k = 0; k < cLookupKeyNum; k++)
+        sLookupKeys[k].resolve(root);
+
+    u32 handle_sum = 0;
+    begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++) {
+        for (s32 i = 0; i < object_num; i++) {
+            for (s32 k = 0; k < cLookupKeyNum; k++) {
+                ByamlData value;
+                s32 key_index = sLookupKeys[k].getKeyIndex(objects[i]);
+                if (objects[i].getByamlDataByKeyIndex(&value, key_index))
+                    handle_sum += value.getValue() + k;
+            }
+        }
+    }
+    s64 handle_time = getBenchmarkNanoSeconds() - begin;
+    delete[] objects;
+
+    s64 lookup_num = (s64)repeatNum * object_num * cLookupKeyNum;
+    report->check("keyHandleSameValues", key_sum == handle_sum);
+    report->beginResult();
+    report->addString("name", "keyLookup");
+    report->addInt("objectNum", object_num);
+    report->addInt("lookupNum", lookup_num);
+    report->addFloat("keyNs", calcNanoSecondsPerCount(key_time, lookup_num));
+    report->addFloat("keyHandleNs", calcNanoSecondsPerCount(handle_time, lookup_num));
+    report->endResult();
+}
+
+// Builds and writes the stage data with the writer nodes on the heap, or in an arena when
+// arenaSize is not 0. usedSize is what the writer holds right before it is destroyed.
+u8* measureWriter(BenchmarkReport* report, sead::Heap* heap, s32 objectNum, u32 arenaSize,
+                  u32* dataSize, u32* usedSize) {
+    s64 begin = getBenchmarkNanoSeconds();
+    size_t free_size = heap->getFreeSize();
+    ByamlWriter* writer = nullptr;
+    {
+        sead::ScopedCurrentHeapSetter setter{heap};
+        writer = arenaSize == 0 ? new ByamlWriter(heap, true) :
+                                  new ByamlWriter(heap, true, arenaSize);
+    }
+    writeStageData(writer, objectNum);
+    u8* data = createData(dataSize, heap, writer);
+    s64 build_time = getBenchmarkNanoSeconds() - begin;
+    *usedSize = arenaSize == 0 ? free_size - heap->getFreeSize() - *dataSize :
+                                 writer->calcArenaUsedSize();
+
+    begin = getBenchmarkNanoSeconds();
+    delete writer;
+    s64 destroy_time = getBenchmarkNanoSeconds() - begin;
+
+    report->beginResult();
+    report->addString("name", arenaSize == 0 ? "writerHeap" : "writerArena");
+    report->addInt("objectNum", objectNum);
+    report->addInt("dataSize", *dataSize);
+    report->addInt("usedSize", *usedSize);
+    report->addFloat("buildUs", build_time / 1000.0);
+    report->addFloat("destroyUs", destroy_time / 1000.0);
+    report->endResult();
+    return data;
+}
+
+bool measureCorpus(BenchmarkReport* report, sead::Heap* heap, s32 corpus, const u8* data,
+                   u32 size, bool isInvertOrder, s32 repeatNum, u32* walkHash) {
+    s64 begin = getBenchmarkNanoSeconds();
+    bool is_valid = true;
+    for (s32 r = 0; r < repeatNum; r++)
+        is_valid = alByamlLocalUtil::verifiByaml(data) && is_valid;
+    s64 verify_time = getBenchmarkNanoSeconds() - begin;
+    if (!is_valid)
+        return false;
+
+    ByamlIter root(data);
+    CorpusIndex index = {};
+    collectTree(&index, root);
+    s32 container_num = index.containerNum;
+    s32 key_num = index.keyNum;
+
+    index.containers = static_cast<ByamlIter*>(
+        heap->tryAlloc(sizeof(ByamlIter) * container_num, alignof(ByamlIter)));
+    index.keys = static_cast<const char**>(heap->tryAlloc(sizeof(const char*) * key_num, 8));
+    index.keyContainers = static_cast<s32*>(heap->tryAlloc(sizeof(s32) * key_num, 4));
+    if (!index.containers || !index.keys || !index.keyContainers) {
+        heap->free(index.containers);
+        heap->free(index.keys);
+        heap->free(index.keyContainers);
+        return false;
+    }
+    index.containerNum = 0;
+    index.keyNum = 0;
+    index.indexReadNum = 0;
+    collectTree(&index, root);
+
+    u32 sum = 0;
+    begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++) {
+        for (s32 i = 0; i < key_num; i++) {
+            ByamlData value;
+            if (index.containers[index.keyContainers[i]].getByamlDataByKey(&value, index.keys[i]))
+                sum += value.getType();
+        }
+    }
+    s64 key_time = getBenchmarkNanoSeconds() - begin;
+
+    begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++) {
+        for (s32 c = 0; c < container_num; c++) {
+            const ByamlIter& container = index.containers[c];
+            s32 container_size = container.getSize();
+            for (s32 i = 0; i < container_size; i++) {
+                ByamlData value;
+                if (container.getByamlDataByIndex(&value, i))
+                    sum += value.getType();
+            }
+        }
+    }
+    s64 index_time = getBenchmarkNanoSeconds() - begin;
+
+    // every container against its neighbour, so that both outcomes are taken
+    begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++)
+        for (s32 c = 0; c < container_num; c++)
+            sum += index.containers[c].isEqualData(index.containers[(c + (r & 1)) % container_num]);
+    s64 equal_time = getBenchmarkNanoSeconds() - begin;
+
+    begin = getBenchmarkNanoSeconds();
+    for (s32 r = 0; r < repeatNum; r++)
+        *walkHash = walkTree(root, 2166136261);
+    s64 walk_time = getBenchmarkNanoSeconds() - begin;
+
+    heap->free(index.containers);
+    heap->free(index.keys);
+    heap->free(index.keyContainers);
+
+    report->beginResult();
+    report->addString("name", cCorpusNames[corpus]);
+    report->addString("order", isInvertOrder ? "inverted" : "host");
+    report->addInt("dataSize", size);
+    report->addInt("containerNum", container_num);
+    report->addFloat("keyLookupNs", calcNanoSecondsPerCount(key_time, (s64)key_num * repeatNum));
+    report->addFloat("indexReadNs",
+                     calcNanoSecondsPerCount(index_time, (s64)index.indexReadNum * repeatNum));
+    report->addFloat("isEqualDataNs",
+                     calcNanoSecondsPerCount(equal_time, (s64)container_num * repeatNum));
+    report->addFloat("verifiByamlUs", calcNanoSecondsPerCount(verify_time, repeatNum) / 1000.0);
+    report->addFloat("walkUs", calcNanoSecondsPerCount(walk_time, repeatNum) / 1000.0);
+    report->endResult();
+    return sum != 0 || container_num == 0;
+}
+}  // namespace
+
+// Key lookups by string against ByamlKeyHandle and the writer with its nodes on the heap against
+// an arena, on a stage-sized placement file. Then synthetic corpora shaped like deep placement
+// trees, wide parameter hashes and large string tables, each read in host and inverted byte order.
+void runByamlBenchmark(BenchmarkReport* report, sead::Heap* heap, bool isQuick) {
+    s32 object_num = isQuick ? 200 : 2000;
+    s32 repeat_num = isQuick ? 5 : 50;
+    s32 scale = isQuick ? 64 : 512;
+    report->beginSuite("byaml");
+
+    u32 data_size = 0;
+    u32 heap_used_size = 0;
+    u8* data = measureWriter(report, heap, object_num, 0, &data_size, &heap_used_size);
+    report->check("writerHeapData", data != nullptr);
+    if (data) {
+        measureKeyLookup(report, heap, data, repeat_num);
+
+        // a frame heap never frees, so the string tables leave their old arrays behind when they
+        // grow
+        u32 arena_data_size = 0;
+        u32 arena_used_size = 0;
+        u8* arena_data = measureWriter(report, heap, object_num, heap_used_size * 2,
+                                       &arena_data_size, &arena_used_size);
+        report->check("writerArenaSameData", arena_data && arena_data_size == data_size &&
+                                                 memcmp(data, arena_data, data_size) == 0);
+        heap->free(arena_data);
+        heap->free(data);
+    }
+
+    for (s32 corpus = 0; corpus < cCorpusNum; corpus++) {
+        char check_name[48];
+        snprintf(check_name, sizeof(check_name), "%sData", cCorpusNames[corpus]);
+        ByamlWriter writer(heap, false);
+        writeCorpus(&writer, corpus, scale);
+        u32 size = 0;
+        u8* corpus_data = createData(&size, heap, &writer);
+        report->check(check_name, corpus_data != nullptr);
+        if (!corpus_data)
+            continue;
+
+        u32 host_hash = 0;
+        u32 inverted_hash = 0;
+        bool is_measured =
+            measureCorpus(report, heap, corpus, corpus_data, size, false, repeat_num, &host_hash) &&
+            alByamlLocalUtil::invertByamlByteOrder(corpus_data, size, heap) &&
+            measureCorpus(report, heap, corpus, corpus_data, size, true, repeat_num,
+                          &inverted_hash);
+        snprintf(check_name, sizeof(check_name), "%sVerified", cCorpusNames[corpus]);
+        report->check(check_name, is_measured);
+        snprintf(check_name, sizeof(check_name), "%sSameWalk", cCorpusNames[corpus]);
+        report->check(check_name, is_measured && host_hash == inverted_hash);
+        heap->free(corpus_data);
+    }
+
+    report->endSuite();
+}
+
+}  // namespace al
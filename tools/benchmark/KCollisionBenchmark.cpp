@@ -0,0 +1,616 @@
+#include <cmath>
+#include <limits>
+#include <math/seadMathCalcCommon.h>
+#include <math/seadQuat.h>
+#include <prim/seadDelegate.h>
+#include <unordered_map>
+#include <vector>
+
+#include "Library/Collision/KCollisionServer.h"
+
+#include "BenchmarkReport.h"
+#include "Benchmarks.h"
+
+namespace al {
+namespace {
+// The octree area is a cube of cAreaSize blocks of one unit, centered on the origin. Leaves are 4
+// or 16 blocks wide, alternating in regions of 16 blocks, so that walks cross both sizes.
+constexpr u32 cAreaSize = 128;
+constexpr f32 cAreaOrigin = -64.0f;
+constexpr u16 cPrismListEnd = 0xFFFF;
+
+class BenchmarkRandom {
+public:
+    BenchmarkRandom(u32 seed) : mState(seed != 0 ? seed : 1) {}
+
+    f32 getRange(f32 min, f32 max) {
+        mState ^= mState << 13;
+        mState ^= mState >> 17;
+        mState ^= mState << 5;
+        return min + (max - min) * ((mState >> 8) * (1.0f / 16777216.0f));
+    }
+
+private:
+    u32 mState;
+};
+
+// Triangles with the prism data KCollisionServer reads. The face normal points to the side the
+// prism is hit from, and the edge normals point away from the triangle in its plane.
+struct HostKCollisionModel {
+    KCPrismHeader header;
+    std::vector<KCPrismData> prisms;
+    std::vector<sead::Vector3f> vertices[3];
+    std::vector<sead::Vector3f> faceNormals;
+    std::vector<sead::Vector3f> edgeNormals[3];
+    std::unordered_map<u64, std::vector<u16>> leaves;
+};
+
+HostKCollisionModel sModel;
+
+s32 calcLeafShift(u32 x, u32 y, u32 z) {
+    return (((x >> 4) + (y >> 4) + (z >> 4)) & 1) ? 4 : 2;
+}
+
+u64 calcLeafKey(u32 x, u32 y, u32 z, s32 shift) {
+    return (u64)(x >> shift) | (u64)(y >> shift) << 16 | (u64)(z >> shift) << 32 |
+           (u64)shift << 48;
+}
+
+sead::Vector3f calcEdgeNormal(const sead::Vector3f& face, const sead::Vector3f& start,
+                              const sead::Vector3f& end, const sead::Vector3f& other) {
+    sead::Vector3f normal;
+    normal.setCross(end - start, face);
+    normal.normalize();
+    if (normal.dot(other - start) > 0.0f)
+        normal *= -1.0f;
+    return normal;
+}
+
+u32 clampBlock(f32 pos) {
+    return (u32)sead::Mathf::clamp(pos - cAreaOrigin, 0.0f, cAreaSize - 1.0f);
+}
+
+// Triangles of 1 to 6 units around random centers inside the area, every leaf touching the bounds
+// of a triangle grown by one block lists it.
+void createModel(s32 triangleNum, u32 seed) {
+    BenchmarkRandom random(seed);
+    sModel = {};
+    for (s32 i = 0; i < triangleNum; i++) {
+        sead::Vector3f center = {random.getRange(-56.0f, 56.0f), random.getRange(-56.0f, 56.0f),
+                                 random.getRange(-56.0f, 56.0f)};
+        f32 size = random.getRange(1.0f, 6.0f);
+        sead::Vector3f v[3];
+        for (s32 j = 0; j < 3; j++)
+            v[j] = center + sead::Vector3f{random.getRange(-size, size),
+                                           random.getRange(-size, size),
+                                           random.getRange(-size, size)};
+
+        sead::Vector3f face;
+        face.setCross(v[1] - v[0], v[2] - v[0]);
+        if (face.length() < 0.01f) {
+            i--;
+            continue;
+        }
+        face.normalize();
+
+        KCPrismData prism = {};
+        prism.mPosIndex = i;
+        prism.mTriIndex = i;
+        sead::Vector3f edge3 = calcEdgeNormal(face, v[1], v[2], v[0]);
+        prism.mLength = (v[1] - v[0]).dot(edge3);
+        sModel.prisms.push_back(prism);
+        sModel.faceNormals.push_back(face);
+        sModel.edgeNormals[0].push_back(calcEdgeNormal(face, v[0], v[1], v[2]));
+        sModel.edgeNormals[1].push_back(calcEdgeNormal(face, v[0], v[2], v[1]));
+        sModel.edgeNormals[2].push_back(edge3);
+        for (s32 j = 0; j < 3; j++)
+            sModel.vertices[j].push_back(v[j]);
+
+        u32 min[3];
+        u32 max[3];
+        for (s32 axis = 0; axis < 3; axis++) {
+            f32 lo = sead::Mathf::min(sead::Mathf::min((&v[0].x)[axis], (&v[1].x)[axis]),
+                                      (&v[2].x)[axis]);
+            f32 hi = sead::Mathf::max(sead::Mathf::max((&v[0].x)[axis], (&v[1].x)[axis]),
+                                      (&v[2].x)[axis]);
+            min[axis] = clampBlock(lo - 1.0f);
+            max[axis] = clampBlock(hi + 1.0f);
+        }
+        for (u32 x = min[0]; x <= max[0]; x++) {
+            for (u32 y = min[1]; y <= max[1]; y++) {
+                for (u32 z = min[2]; z <= max[2]; z++) {
+                    std::vector<u16>& leaf =
+                        sModel.leaves[calcLeafKey(x, y, z, calcLeafShift(x, y, z))];
+                    if (leaf.empty() || leaf.back() != i)
+                        leaf.push_back(i);
+                }
+            }
+        }
+    }
+    for (auto& leaf : sModel.leaves)
+        leaf.second.push_back(cPrismListEnd);
+}
+
+sead::Vector3f calcClosestPoint(const sead::Vector3f& pos, const sead::Vector3f& a,
+                                const sead::Vector3f& b, const sead::Vector3f& c) {
+    sead::Vector3f ab = b - a;
+    sead::Vector3f ac = c - a;
+    sead::Vector3f ap = pos - a;
+    f32 d1 = ab.dot(ap);
+    f32 d2 = ac.dot(ap);
+    if (d1 <= 0.0f && d2 <= 0.0f)
+        return a;
+
+    sead::Vector3f bp = pos - b;
+    f32 d3 = ab.dot(bp);
+    f32 d4 = ac.dot(bp);
+    if (d3 >= 0.0f && d4 <= d3)
+        return b;
+
+    f32 vc = d1 * d4 - d3 * d2;
+    if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f)
+        return a + ab * (d1 / (d1 - d3));
+
+    sead::Vector3f cp = pos - c;
+    f32 d5 = ab.dot(cp);
+    f32 d6 = ac.dot(cp);
+    if (d6 >= 0.0f && d5 <= d6)
+        return c;
+
+    f32 vb = d5 * d2 - d1 * d6;
+    if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f)
+        return a + ac * (d2 / (d2 - d6));
+
+    f32 va = d3 * d6 - d5 * d4;
+    if (va <= 0.0f && d4 - d3 >= 0.0f && d5 - d6 >= 0.0f)
+        return b + (c - b) * ((d4 - d3) / ((d4 - d3) + (d5 - d6)));
+
+    f32 denom = 1.0f / (va + vb + vc);
+    return a + ab * (vb * denom) + ac * (vc * denom);
+}
+
+// The prisms hit by one query, each of them once.
+class PrismHitSet {
+public:
+    void add(const KCPrismData* data) {
+        for (const KCPrismData* hit : mHits)
+            if (hit == data)
+                return;
+        mHits.push_back(data);
+    }
+
+    bool isContain(const KCPrismData* data) const {
+        for (const KCPrismData* hit : mHits)
+            if (hit == data)
+                return true;
+        return false;
+    }
+
+    bool isSame(const PrismHitSet& other) const {
+        if (mHits.size() != other.mHits.size())
+            return false;
+        for (const KCPrismData* hit : mHits)
+            if (!other.isContain(hit))
+                return false;
+        return true;
+    }
+
+    s32 getHitNum() const { return mHits.size(); }
+
+    void clear() { mHits.clear(); }
+
+private:
+    std::vector<const KCPrismData*> mHits;
+};
+
+class ArrowHitTester : public KCArrowSearchCallback {
+public:
+    ArrowHitTester(const KCollisionServer* server, const sead::Vector3f& pos,
+                   const sead::Vector3f& dir, PrismHitSet* hitSet)
+        : mServer(server), mPos(pos), mDir(dir), mHitSet(hitSet) {}
+
+    void test(const KCPrismData* data, const KCPrismHeader* header) {
+        mVisitNum++;
+        f32 distance = 0.0f;
+        u8 location = 0;
+        if (mServer->KCHitArrow(data, header, mPos, mDir, &distance, &location)) {
+            mHitSet->add(data);
+            mDistance = sead::Mathf::min(mDistance, distance);
+        }
+    }
+
+    f32 visitPrism(const KCPrismData* data, const KCPrismHeader* header) override {
+        test(data, header);
+        return 1.0f;
+    }
+
+    s32 getVisitNum() const { return mVisitNum; }
+
+    f32 getDistance() const { return mDistance; }
+
+private:
+    const KCollisionServer* mServer;
+    sead::Vector3f mPos;
+    sead::Vector3f mDir;
+    PrismHitSet* mHitSet;
+    s32 mVisitNum = 0;
+    f32 mDistance = 2.0f;
+};
+
+// Asks the march for no more of the arrow than up to the nearest hit so far.
+class NearestArrowHitFinder : public KCArrowSearchCallback {
+public:
+    NearestArrowHitFinder(const KCollisionServer* server, const sead::Vector3f& pos,
+                          const sead::Vector3f& dir)
+        : mServer(server), mPos(pos), mDir(dir) {}
+
+    f32 visitPrism(const KCPrismData* data, const KCPrismHeader* header) override {
+        f32 distance = 0.0f;
+        u8 location = 0;
+        if (mServer->KCHitArrow(data, header, mPos, mDir, &distance, &location))
+            mDistance = sead::Mathf::min(mDistance, distance);
+        return sead::Mathf::min(mDistance, 1.0f);
+    }
+
+    f32 getDistance() const { return mDistance; }
+
+private:
+    const KCollisionServer* mServer;
+    sead::Vector3f mPos;
+    sead::Vector3f mDir;
+    f32 mDistance = 2.0f;
+};
+
+class SphereHitTester {
+public:
+    SphereHitTester(KCollisionServer* server, const sead::Vector3f& pos, f32 radius,
+                    PrismHitSet* hitSet)
+        : mServer(server), mPos(pos), mRadius(radius), mHitSet(hitSet) {}
+
+    void test(const KCPrismData* data, const KCPrismHeader* header) {
+        f32 distance = 0.0f;
+        u8 location = 0;
+        if (mServer->KCHitSphere(data, header, &mPos, mRadius, 0.0f, &distance, &location))
+            mHitSet->add(data);
+    }
+
+private:
+    KCollisionServer* mServer;
+    sead::Vector3f mPos;
+    f32 mRadius;
+    PrismHitSet* mHitSet;
+};
+
+void searchArrowReference(KCollisionServer* server, ArrowHitTester* tester,
+                          const sead::Vector3f& pos, const sead::Vector3f& end) {
+    sead::Vector3f min = {sead::Mathf::min(pos.x, end.x), sead::Mathf::min(pos.y, end.y),
+                          sead::Mathf::min(pos.z, end.z)};
+    sead::Vector3f max = {sead::Mathf::max(pos.x, end.x), sead::Mathf::max(pos.y, end.y),
+                          sead::Mathf::max(pos.z, end.z)};
+    sead::Delegate2<ArrowHitTester, const KCPrismData*, const KCPrismHeader*> callback(
+        tester, &ArrowHitTester::test);
+    server->searchPrismMinMax(min, max, callback);
+}
+
+// Half of the arrows cross the area between two random points, the other half are short arrows of
+// up to 8 units on each axis. Every sixteenth arrow gets a NaN or infinite component. The
+// prisms marchPrismArrowLeaves visits must give the same hits as searchPrismMinMax over the bounds
+// of the arrow, and a march that stops at the nearest hit must find the same distance.
+void measureArrow(BenchmarkReport* report, KCollisionServer* server, s32 arrowNum) {
+    BenchmarkRandom random(7);
+    KCPrismVisitedBuffer visited_buffer;
+    PrismHitSet reference_set;
+    PrismHitSet march_set;
+    s32 hit_num = 0;
+    s32 mismatch_num = 0;
+    s32 nearest_mismatch_num = 0;
+    s32 non_finite_visit_num = 0;
+    s64 reference_visit_num = 0;
+    s64 march_visit_num = 0;
+    s64 reference_time = 0;
+    s64 march_time = 0;
+    s64 nearest_time = 0;
+
+    for (s32 i = 0; i < arrowNum; i++) {
+        sead::Vector3f pos = {random.getRange(-64.0f, 64.0f), random.getRange(-64.0f, 64.0f),
+                              random.getRange(-64.0f, 64.0f)};
+        sead::Vector3f end;
+        if (i % 2 == 0)
+            end = {random.getRange(-64.0f, 64.0f), random.getRange(-64.0f, 64.0f),
+                   random.getRange(-64.0f, 64.0f)};
+        else
+            end = pos + sead::Vector3f{random.getRange(-8.0f, 8.0f), random.getRange(-8.0f, 8.0f),
+                                       random.getRange(-8.0f, 8.0f)};
+        sead::Vector3f dir = end - pos;
+
+        march_set.clear();
+        ArrowHitTester march_tester(server, pos, dir, &march_set);
+        if (i % 16 == 15) {
+            f32 value = (i / 16) % 2 == 0 ? std::numeric_limits<f32>::quiet_NaN() :
+                                            std::numeric_limits<f32>::infinity();
+            sead::Vector3f* target = (i / 32) % 2 == 0 ? &pos : &end;
+            s32 axis = (i / 64) % 3;
+            if (axis == 0)
+                target->x = value;
+            else if (axis == 1)
+                target->y = value;
+            else
+                target->z = value;
+            server->marchPrismArrowLeaves(pos, end, march_tester, &visited_buffer);
+            if (march_tester.getVisitNum() != 0)
+                non_finite_visit_num++;
+            continue;
+        }
+
+        reference_set.clear();
+        ArrowHitTester reference_tester(server, pos, dir, &reference_set);
+        s64 begin = getBenchmarkNanoSeconds();
+        searchArrowReference(server, &reference_tester, pos, end);
+        reference_time += getBenchmarkNanoSeconds() - begin;
+        reference_visit_num += reference_tester.getVisitNum();
+        hit_num += reference_set.getHitNum();
+
+        begin = getBenchmarkNanoSeconds();
+        server->marchPrismArrowLeaves(pos, end, march_tester, &visited_buffer);
+        march_time += getBenchmarkNanoSeconds() - begin;
+        march_visit_num += march_tester.getVisitNum();
+        if (!march_set.isSame(reference_set))
+            mismatch_num++;
+
+        NearestArrowHitFinder nearest_finder(server, pos, dir);
+        begin = getBenchmarkNanoSeconds();
+        server->marchPrismArrowLeaves(pos, end, nearest_finder, &visited_buffer);
+        nearest_time += getBenchmarkNanoSeconds() - begin;
+        if (nearest_finder.getDistance() != reference_tester.getDistance())
+            nearest_mismatch_num++;
+    }
+
+    report->check("arrowSameHits", mismatch_num == 0);
+    report->check("arrowSameNearest", nearest_mismatch_num == 0);
+    report->check("arrowNonFiniteNoVisit", non_finite_visit_num == 0);
+    s32 finite_num = arrowNum - arrowNum / 16;
+    report->beginResult();
+    report->addString("name", "arrow");
+    report->addInt("triangleNum", sModel.prisms.size());
+    report->addInt("arrowNum", arrowNum);
+    report->addInt("hitNum", hit_num);
+    report->addInt("referenceVisitNum", reference_visit_num);
+    report->addInt("marchVisitNum", march_visit_num);
+    report->addFloat("referenceNs", (f64)reference_time / finite_num);
+    report->addFloat("marchNs", (f64)march_time / finite_num);
+    report->addFloat("marchNearestNs", (f64)nearest_time / finite_num);
+    report->endResult();
+}
+
+// Groups of up to KCSphereBatchBuffer::cSphereNumMax spheres of 0.5 to 3 units around a random
+// point, as the spheres of one actor. checkSphereBatch must find the same prisms for every sphere
+// as searchPrismMinMax over the bounds of that sphere, each of them once.
+void measureSphereBatch(BenchmarkReport* report, KCollisionServer* server, s32 groupNum) {
+    constexpr s32 cSphereNum = KCSphereBatchBuffer::cSphereNumMax;
+    BenchmarkRandom random(11);
+    KCSphereBatchBuffer* buffer = new KCSphereBatchBuffer;
+    auto* hits_list = new sead::FixedRingBuffer<KCHitInfo, 512>[cSphereNum];
+    sead::Vector3f positions[cSphereNum];
+    f32 radii[cSphereNum];
+    PrismHitSet reference_set;
+    PrismHitSet batch_set;
+    s32 hit_num = 0;
+    s32 mismatch_num = 0;
+    s32 duplicate_num = 0;
+    s64 reference_time = 0;
+    s64 batch_time = 0;
+
+    for (s32 g = 0; g < groupNum; g++) {
+        sead::Vector3f center = {random.getRange(-56.0f, 56.0f), random.getRange(-56.0f, 56.0f),
+                                 random.getRange(-56.0f, 56.0f)};
+        for (s32 i = 0; i < cSphereNum; i++) {
+            positions[i] = center + sead::Vector3f{random.getRange(-6.0f, 6.0f),
+                                                   random.getRange(-6.0f, 6.0f),
+                                                   random.getRange(-6.0f, 6.0f)};
+            radii[i] = random.getRange(0.5f, 3.0f);
+            hits_list[i].clear();
+        }
+
+        s64 begin = getBenchmarkNanoSeconds();
+        server->checkSphereBatch(positions, radii, cSphereNum, 0.0f, hits_list, buffer);
+        batch_time += getBenchmarkNanoSeconds() - begin;
+
+        for (s32 i = 0; i < cSphereNum; i++) {
+            reference_set.clear();
+            SphereHitTester tester(server, positions[i], radii[i], &reference_set);
+            sead::Delegate2<SphereHitTester, const KCPrismData*, const KCPrismHeader*> callback(
+                &tester, &SphereHitTester::test);
+            sead::Vector3f margin = {radii[i], radii[i], radii[i]};
+            begin = getBenchmarkNanoSeconds();
+            server->searchPrismMinMax(positions[i] - margin, positions[i] + margin, callback);
+            reference_time += getBenchmarkNanoSeconds() - begin;
+
+            batch_set.clear();
+            for (s32 j = 0; j < hits_list[i].size(); j++)
+                batch_set.add(hits_list[i][j].mData);
+            if (batch_set.getHitNum() != hits_list[i].size())
+                duplicate_num++;
+            if (!batch_set.isSame(reference_set))
+                mismatch_num++;
+            hit_num += reference_set.getHitNum();
+        }
+    }
+    delete[] hits_list;
+    delete buffer;
+
+    report->check("sphereBatchSameHits", mismatch_num == 0);
+    report->check("sphereBatchNoDuplicate", duplicate_num == 0);
+    report->beginResult();
+    report->addString("name", "sphereBatch");
+    report->addInt("triangleNum", sModel.prisms.size());
+    report->addInt("sphereNum", groupNum * cSphereNum);
+    report->addInt("hitNum", hit_num);
+    report->addFloat("referenceUs", reference_time / 1000.0 / groupNum);
+    report->addFloat("batchUs", batch_time / 1000.0 / groupNum);
+    report->endResult();
+}
+}  // namespace
+
+// Host stand-ins for the KCollisionServer functions the queries need, none of which are
+// decompiled yet. They read the synthetic model above instead of loaded KCL data: KCHitArrow and
+// KCHitSphere are plain segment and sphere tests against the triangle, and searchPrismMinMax lists
+// the prisms of every leaf that touches the box.
+KCollisionServer::KCollisionServer() = default;
+
+u32 KCollisionServer::getNumInnerKcl() const {
+    return 1;
+}
+
+const KCPrismHeader& KCollisionServer::getInnerKcl(s32 index) const {
+    return sModel.header;
+}
+
+s32 KCollisionServer::getTriangleNum(const KCPrismHeader* header) const {
+    return sModel.prisms.size();
+}
+
+const KCPrismData& KCollisionServer::getPrismData(u32 index, const KCPrismHeader* header) const {
+    return sModel.prisms[index];
+}
+
+void KCollisionServer::objectSpaceToAreaOffsetSpaceV3f(sead::Vector3f* areaOff,
+                                                       const sead::Vector3f& objSpace,
+                                                       const KCPrismHeader* header) const {
+    *areaOff = objSpace - sead::Vector3f{cAreaOrigin, cAreaOrigin, cAreaOrigin};
+}
+
+void KCollisionServer::getAreaSpaceSize(sead::Vector3f* size, const KCPrismHeader* header) const {
+    *size = {(f32)cAreaSize, (f32)cAreaSize, (f32)cAreaSize};
+}
+
+const u8* KCollisionServer::searchBlock(s32* widthShift, const sead::Vector3u& block,
+                                        const KCPrismHeader* header) const {
+    *widthShift = calcLeafShift(block.x, block.y, block.z);
+    auto leaf = sModel.leaves.find(calcLeafKey(block.x, block.y, block.z, *widthShift));
+    if (leaf == sModel.leaves.end())
+        return nullptr;
+    return reinterpret_cast<const u8*>(leaf->second.data());
+}
+
+const sead::Vector3f& KCollisionServer::getVertexData(u32 index,
+                                                      const KCPrismHeader* header) const {
+    return sModel.vertices[0][index];
+}
+
+const sead::Vector3f& KCollisionServer::getFaceNormal(const KCPrismData* data,
+                                                      const KCPrismHeader* header) const {
+    return sModel.faceNormals[data->mTriIndex];
+}
+
+const sead::Vector3f& KCollisionServer::getEdgeNormal1(const KCPrismData* data,
+                                                       const KCPrismHeader* header) const {
+    return sModel.edgeNormals[0][data->mTriIndex];
+}
+
+const sead::Vector3f& KCollisionServer::getEdgeNormal2(const KCPrismData* data,
+                                                       const KCPrismHeader* header) const {
+    return sModel.edgeNormals[1][data->mTriIndex];
+}
+
+const sead::Vector3f& KCollisionServer::getEdgeNormal3(const KCPrismData* data,
+                                                       const KCPrismHeader* header) const {
+    return sModel.edgeNormals[2][data->mTriIndex];
+}
+
+bool KCollisionServer::KCHitArrow(const KCPrismData* data, const KCPrismHeader* header,
+                                  const sead::Vector3f& pos, const sead::Vector3f& dir,
+                                  f32* distance, u8* location) const {
+    u32 index = data->mTriIndex;
+    sead::Vector3f a = sModel.vertices[0][index];
+    sead::Vector3f e1 = sModel.vertices[1][index] - a;
+    sead::Vector3f e2 = sModel.vertices[2][index] - a;
+    sead::Vector3f p;
+    p.setCross(dir, e2);
+    f32 det = e1.dot(p);
+    if (std::fabs(det) < 1e-9f)
+        return false;
+
+    f32 inv_det = 1.0f / det;
+    sead::Vector3f s = pos - a;
+    f32 u = s.dot(p) * inv_det;
+    if (u < 0.0f || u > 1.0f)
+        return false;
+    sead::Vector3f q;
+    q.setCross(s, e1);
+    f32 v = dir.dot(q) * inv_det;
+    if (v < 0.0f || u + v > 1.0f)
+        return false;
+    f32 t = e2.dot(q) * inv_det;
+    if (t < 0.0f || t > 1.0f)
+        return false;
+
+    *distance = t;
+    *location = 0;
+    return true;
+}
+
+bool KCollisionServer::KCHitSphere(const KCPrismData* data, const KCPrismHeader* header,
+                                   const sead::Vector3f* pos, f32 radius, f32 unk, f32* distance,
+                                   u8* location) {
+    u32 index = data->mTriIndex;
+    sead::Vector3f closest = calcClosestPoint(*pos, sModel.vertices[0][index],
+                                              sModel.vertices[1][index], sModel.vertices[2][index]);
+    f32 length = (closest - *pos).length();
+    if (length > radius)
+        return false;
+
+    *distance = radius - length;
+    *location = 0;
+    return true;
+}
+
+void KCollisionServer::searchPrismMinMax(
+    const sead::Vector3f& min, const sead::Vector3f& max,
+    sead::IDelegate2<const KCPrismData*, const KCPrismHeader*>& callback) {
+    u32 block_min[3] = {clampBlock(min.x), clampBlock(min.y), clampBlock(min.z)};
+    u32 block_max[3] = {clampBlock(max.x), clampBlock(max.y), clampBlock(max.z)};
+    for (s32 shift = 2; shift <= 4; shift += 2) {
+        for (u32 x = block_min[0] >> shift; x <= block_max[0] >> shift; x++) {
+            for (u32 y = block_min[1] >> shift; y <= block_max[1] >> shift; y++) {
+                for (u32 z = block_min[2] >> shift; z <= block_max[2] >> shift; z++) {
+                    u32 block[3] = {x << shift, y << shift, z << shift};
+                    if (calcLeafShift(block[0], block[1], block[2]) != shift)
+                        continue;
+                    auto leaf = sModel.leaves.find(calcLeafKey(block[0], block[1], block[2], shift));
+                    if (leaf == sModel.leaves.end())
+                        continue;
+                    for (const u16* index = leaf->second.data(); *index != cPrismListEnd; index++)
+                        callback(&sModel.prisms[*index], &sModel.header);
+                }
+            }
+        }
+    }
+}
+
+// SpherePoseInterpolator in the same file needs these from Math/MathUtil.cpp, which are not
+// decompiled yet either. The benchmarks never interpolate.
+f32 calcRate01(f32 value, f32 min, f32 max) {
+    return sead::Mathf::clamp((value - min) / (max - min), 0.0f, 1.0f);
+}
+
+void slerpQuat(sead::Quatf* out, const sead::Quatf& from, const sead::Quatf& to, f32 rate) {
+    out->x = from.x + (to.x - from.x) * rate;
+    out->y = from.y + (to.y - from.y) * rate;
+    out->z = from.z + (to.z - from.z) * rate;
+    out->w = from.w + (to.w - from.w) * rate;
+}
+
+void runKCollisionBenchmark(BenchmarkReport* report, bool isQuick) {
+    report->beginSuite("kcollision");
+    KCollisionServer* server = new KCollisionServer;
+    for (s32 triangle_num : {4000, 40000}) {
+        createModel(triangle_num, triangle_num);
+        measureArrow(report, server, isQuick ? 2000 : 20000);
+        measureSphereBatch(report, server, isQuick ? 100 : 2000);
+    }
+    delete server;
+    sModel = {};
+    report->endSuite();
+}
+
+}  // namespace al
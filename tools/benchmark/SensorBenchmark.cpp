@@ -0,0 +1,435 @@
+#include <math/seadMathCalcCommon.h>
+#include <math/seadVector.h>
+#include <thread>
+#include <unordered_map>
+
+#include "Project/Execute/ExecuteAsyncExecutor.h"
+#include "Project/HitSensor/HitSensor.h"
+#include "Project/HitSensor/SensorHitCheckJobQueue.h"
+#include "Project/HitSensor/SensorHitGrid.h"
+#include "Project/HitSensor/SensorHitGroup.h"
+
+#include "BenchmarkReport.h"
+#include "Benchmarks.h"
+
+namespace al {
+namespace {
+const char* const cLayoutNames[] = {"even", "cluster", "far"};
+constexpr s32 cLayoutNum = sizeof(cLayoutNames) / sizeof(cLayoutNames[0]);
+const s32 cSensorNums[] = {128, 256, 512, 1024, SensorHitGrid::cMaxSensorNum};
+// room per sensor of the even layouts, a full group spreads over about 14km on each side
+constexpr f32 cSensorSpacing = 300.0f;
+constexpr s32 cClusterNum = 6;
+constexpr f32 cFarOffset = 6.0e6f;
+// small enough that clustered sensors fill their hit sensor lists
+constexpr u16 cHitSensorMaxNum = 16;
+
+std::unordered_map<const ExecuteAsyncExecutor*, std::thread> sAsyncThreads;
+
+class SensorRandom {
+public:
+    SensorRandom(u32 seed) : mState(seed != 0 ? seed : 1) {}
+
+    f32 getRange(f32 min, f32 max) {
+        mState ^= mState << 13;
+        mState ^= mState >> 17;
+        mState ^= mState << 5;
+        return min + (max - min) * ((mState >> 8) * (1.0f / 16777216.0f));
+    }
+
+private:
+    u32 mState;
+};
+
+u32 mixHash(u32 hash, u32 value) {
+    return (hash ^ value) * 16777619;
+}
+
+// Positions and radii of one synthetic group, in the packed layout of SensorHitGroup.
+struct SensorLayout {
+    f32 posX[SensorHitGrid::cMaxSensorNum];
+    f32 posY[SensorHitGrid::cMaxSensorNum];
+    f32 posZ[SensorHitGrid::cMaxSensorNum];
+    f32 radius[SensorHitGrid::cMaxSensorNum];
+    s32 sensorNum;
+
+    // Same test as HitSensorDirector::executeHitCheck.
+    bool isOverlap(s32 a, s32 b) const {
+        sead::Vector3f distance = {posX[a] - posX[b], posY[a] - posY[b], posZ[a] - posZ[b]};
+        return !(distance.squaredLength() >= sead::Mathf::square(radius[a] + radius[b]));
+    }
+};
+
+// Most sensors are 20 to 80 units, like those of enemies and items, and one in eight is 100 to
+// 400 units, like those of large map objects. Even and far layouts keep the density of sensors the
+// same at every size, far ones several million units away from the origin.
+void createLayout(SensorLayout* layout, s32 layoutIndex, s32 sensorNum, u32 seed) {
+    SensorRandom random(seed);
+    f32 extent = sead::Mathf::sqrt(sensorNum * cSensorSpacing * cSensorSpacing);
+    f32 offset = layoutIndex == 2 ? cFarOffset : 0.0f;
+
+    sead::Vector3f clusters[cClusterNum];
+    for (s32 i = 0; i < cClusterNum; i++)
+        clusters[i] = {random.getRange(-extent, extent), random.getRange(-500.0f, 500.0f),
+                       random.getRange(-extent, extent)};
+
+    layout->sensorNum = sensorNum;
+    for (s32 i = 0; i < sensorNum; i++) {
+        if (layoutIndex == 1) {
+            const sead::Vector3f& center = clusters[i % cClusterNum];
+            layout->posX[i] = center.x + random.getRange(-600.0f, 600.0f);
+            layout->posY[i] = center.y + random.getRange(-200.0f, 200.0f);
+            layout->posZ[i] = center.z + random.getRange(-600.0f, 600.0f);
+        } else {
+            layout->posX[i] = offset + random.getRange(-extent, extent) * 0.5f;
+            layout->posY[i] = random.getRange(-500.0f, 500.0f);
+            layout->posZ[i] = offset + random.getRange(-extent, extent) * 0.5f;
+        }
+        layout->radius[i] =
+            i % 8 == 7 ? random.getRange(100.0f, 400.0f) : random.getRange(20.0f, 80.0f);
+    }
+}
+
+// Checks the group against itself, every pair once, as HitSensorDirector does for the groups that
+// are checked against themselves, through a SensorHitGrid and over all pairs. Both must find the
+// same pairs in the same order.
+bool measureGrid(BenchmarkReport* report, const SensorLayout& layout, const char* layoutName,
+                 s32 repeatNum) {
+    s32 sensor_num = layout.sensorNum;
+    s32 word_num = (sensor_num + 63) / 64;
+    SensorHitGrid grid(sensor_num);
+
+    u32 grid_hash = 0;
+    s32 grid_pair_num = 0;
+    s64 build_time = 0;
+    s64 grid_time = 0;
+    for (s32 r = 0; r < repeatNum; r++) {
+        s64 begin = getBenchmarkNanoSeconds();
+        grid.build(layout.posX, layout.posY, layout.posZ, layout.radius, sensor_num);
+        build_time += getBenchmarkNanoSeconds() - begin;
+
+        grid_hash = 0;
+        grid_pair_num = 0;
+        begin = getBenchmarkNanoSeconds();
+        for (s32 i = 0; i < sensor_num; i++) {
+            u64 candidates[SensorHitGrid::cCandidateWordNum] = {};
+            grid.collectCandidates(candidates, {layout.posX[i], layout.posY[i], layout.posZ[i]},
+                                   layout.radius[i]);
+            for (s32 w = i / 64; w < word_num; w++) {
+                for (u64 bits = candidates[w]; bits != 0; bits &= bits - 1) {
+                    s32 j = w * 64 + __builtin_ctzll(bits);
+                    if (j <= i || !layout.isOverlap(i, j))
+                        continue;
+                    grid_hash = mixHash(mixHash(grid_hash, i), j);
+                    grid_pair_num++;
+                }
+            }
+        }
+        grid_time += getBenchmarkNanoSeconds() - begin;
+    }
+
+    u32 full_hash = 0;
+    s32 full_pair_num = 0;
+    s64 full_time = 0;
+    for (s32 r = 0; r < repeatNum; r++) {
+        full_hash = 0;
+        full_pair_num = 0;
+        s64 begin = getBenchmarkNanoSeconds();
+        for (s32 i = 0; i < sensor_num; i++) {
+            for (s32 j = i + 1; j < sensor_num; j++) {
+                if (!layout.isOverlap(i, j))
+                    continue;
+                full_hash = mixHash(mixHash(full_hash, i), j);
+                full_pair_num++;
+            }
+        }
+        full_time += getBenchmarkNanoSeconds() - begin;
+    }
+
+    report->beginResult();
+    report->addString("name", "grid");
+    report->addString("layout", layoutName);
+    report->addInt("sensorNum", sensor_num);
+    report->addInt("largeSensorNum", grid.getLargeSensorNum());
+    report->addInt("memorySize", grid.calcMemorySize());
+    report->addInt("pairNum", full_pair_num);
+    report->addFloat("buildUs", build_time / 1000.0 / repeatNum);
+    report->addFloat("gridCheckUs", grid_time / 1000.0 / repeatNum);
+    report->addFloat("fullCheckUs", full_time / 1000.0 / repeatNum);
+    report->endResult();
+    return grid_pair_num == full_pair_num && grid_hash == full_hash;
+}
+
+// Sensors of one layout in two groups, in runs of seven that alternate between them, so that both
+// groups have sensors in every cluster. Two sensors share each parent, some of them across the
+// groups, and every fifth one is an eye.
+class SensorGroupSet {
+public:
+    SensorGroupSet(const SensorLayout& layout) : mSensorNum(layout.sensorNum) {
+        mGroups[0] = new SensorHitGroup(mSensorNum, "First");
+        mGroups[1] = new SensorHitGroup(mSensorNum, "Second");
+        for (s32 i = 0; i < mSensorNum; i++) {
+            // the parents are only compared, never used as actors
+            LiveActor* parent_actor = reinterpret_cast<LiveActor*>(&mParentTags[i / 2]);
+            HitSensorType type = i % 5 == 4 ? HitSensorType::Eye : HitSensorType::EnemyBody;
+            sead::Vector3f pos = {layout.posX[i], layout.posY[i], layout.posZ[i]};
+            mSensors[i] = new HitSensor(parent_actor, "Body", static_cast<u32>(type),
+                                        layout.radius[i], cHitSensorMaxNum, nullptr, nullptr, pos);
+            mSensorIndices[mSensors[i]] = i;
+            mGroups[i / 7 % 2]->add(mSensors[i]);
+        }
+    }
+
+    ~SensorGroupSet() {
+        for (s32 i = 0; i < mSensorNum; i++)
+            delete mSensors[i];
+        delete mGroups[0];
+        delete mGroups[1];
+    }
+
+    SensorHitGroup* getGroup(s32 index) const { return mGroups[index]; }
+
+    void resetHitSensors() {
+        for (s32 i = 0; i < mSensorNum; i++)
+            mSensors[i]->validate();
+    }
+
+    // Hash over the hit sensors of every sensor in order, as indices into the layout.
+    u32 calcHitSensorHash(s32* hitNum) const {
+        u32 hash = 0;
+        *hitNum = 0;
+        for (s32 i = 0; i < mSensorNum; i++) {
+            const HitSensor* sensor = mSensors[i];
+            hash = mixHash(hash, sensor->getSensorCount());
+            for (s32 j = 0; j < sensor->getSensorCount(); j++)
+                hash = mixHash(hash, mSensorIndices.at(sensor->getSensor(j)));
+            *hitNum += sensor->getSensorCount();
+        }
+        return hash;
+    }
+
+private:
+    s32 mSensorNum;
+    HitSensor* mSensors[SensorHitGrid::cMaxSensorNum];
+    u8 mParentTags[SensorHitGrid::cMaxSensorNum / 2];
+    std::unordered_map<const HitSensor*, s32> mSensorIndices;
+    SensorHitGroup* mGroups[2];
+};
+
+bool isEyeSensor(const HitSensor* sensor) {
+    return sensor->getType() == HitSensorType::Eye || sensor->getType() == HitSensorType::PlayerEye;
+}
+
+// Same as HitSensorDirector::executeHitCheck, which needs the whole director.
+void checkSensorPair(HitSensor* sensor, HitSensor* otherSensor) {
+    if (sensor->getParentActor() == otherSensor->getParentActor())
+        return;
+    sead::Vector3f distance = sensor->getPos() - otherSensor->getPos();
+    f32 combined_radius = sensor->getRadius() + otherSensor->getRadius();
+    if (distance.squaredLength() >= sead::Mathf::square(combined_radius))
+        return;
+    if (!isEyeSensor(otherSensor))
+        sensor->addHitSensor(otherSensor);
+    if (!isEyeSensor(sensor))
+        otherSensor->addHitSensor(sensor);
+}
+
+// The serial checks of HitSensorDirector without AL_SENSOR_HIT_BROADPHASE, in the same order as
+// the jobs measureJobQueue queues.
+void checkSerial(SensorHitGroup* group, SensorHitGroup* group2) {
+    for (s32 i = 0; i < group->getSensorCount(); i++)
+        for (s32 j = i; j < group->getSensorCount(); j++)
+            checkSensorPair(group->getSensor(i), group->getSensor(j));
+    for (s32 i = 0; i < group->getSensorCount(); i++)
+        for (s32 j = 0; j < group2->getSensorCount(); j++)
+            checkSensorPair(group->getSensor(i), group2->getSensor(j));
+    for (s32 i = 0; i < group2->getSensorCount(); i++)
+        for (s32 j = i; j < group2->getSensorCount(); j++)
+            checkSensorPair(group2->getSensor(i), group2->getSensor(j));
+}
+
+// Runs the checks of two groups, each against itself and against the other, through
+// SensorHitCheckJobQueue and serially. Every sensor must get the same hit sensors in the same
+// order from both.
+bool measureJobQueue(BenchmarkReport* report, SensorHitCheckJobQueue* jobQueue,
+                     const SensorLayout& layout, const char* layoutName, s32 repeatNum) {
+    SensorGroupSet* serial_set = new SensorGroupSet(layout);
+    SensorGroupSet* queue_set = new SensorGroupSet(layout);
+    SensorHitGroup* group = queue_set->getGroup(0);
+    SensorHitGroup* group2 = queue_set->getGroup(1);
+
+    s64 serial_time = 0;
+    s64 queue_time = 0;
+    for (s32 r = 0; r < repeatNum; r++) {
+        serial_set->resetHitSensors();
+        s64 begin = getBenchmarkNanoSeconds();
+        checkSerial(serial_set->getGroup(0), serial_set->getGroup(1));
+        serial_time += getBenchmarkNanoSeconds() - begin;
+
+        queue_set->resetHitSensors();
+        begin = getBenchmarkNanoSeconds();
+        group->updatePackedData();
+        group2->updatePackedData();
+        jobQueue->clear();
+        jobQueue->addSameGroup(group);
+        jobQueue->addGroupPair(group, group2);
+        jobQueue->addSameGroup(group2);
+        jobQueue->execute();
+        queue_time += getBenchmarkNanoSeconds() - begin;
+    }
+
+    s32 serial_hit_num = 0;
+    s32 queue_hit_num = 0;
+    u32 serial_hash = serial_set->calcHitSensorHash(&serial_hit_num);
+    u32 queue_hash = queue_set->calcHitSensorHash(&queue_hit_num);
+    delete serial_set;
+    delete queue_set;
+
+    report->beginResult();
+    report->addString("name", "jobQueue");
+    report->addString("layout", layoutName);
+    report->addInt("sensorNum", layout.sensorNum);
+    report->addInt("hitNum", serial_hit_num);
+    report->addFloat("serialUs", serial_time / 1000.0 / repeatNum);
+    report->addFloat("queueUs", queue_time / 1000.0 / repeatNum);
+    report->endResult();
+    return serial_hit_num == queue_hit_num && serial_hash == queue_hash;
+}
+
+// Compares SensorHitGroup::calcOverlapMask, four sensors at a time on AArch64, against the
+// distance test of HitSensorDirector::executeHitCheck on the sensors themselves, for every sensor
+// of the first group against every word of the second.
+bool measureOverlapMask(BenchmarkReport* report, const SensorLayout& layout,
+                        const char* layoutName) {
+    SensorGroupSet* set = new SensorGroupSet(layout);
+    SensorHitGroup* group = set->getGroup(0);
+    SensorHitGroup* group2 = set->getGroup(1);
+    group->updatePackedData();
+    group2->updatePackedData();
+
+    s32 row_num = group->getSensorCount();
+    s32 sensor_count = group2->getSensorCount();
+    s32 word_num = (sensor_count + 63) / 64;
+    u64* masks = new u64[row_num * word_num];
+    u64* scalar_masks = new u64[row_num * word_num];
+
+    s64 begin = getBenchmarkNanoSeconds();
+    for (s32 i = 0; i < row_num; i++) {
+        const HitSensor* sensor = group->getSensor(i);
+        for (s32 w = 0; w < word_num; w++) {
+            s32 bit_num = sensor_count - w * 64 < 64 ? sensor_count - w * 64 : 64;
+            u64 candidates = bit_num == 64 ? ~0ull : (1ull << bit_num) - 1;
+            masks[i * word_num + w] =
+                group2->calcOverlapMask(w, candidates, sensor->getPos(), sensor->getRadius());
+        }
+    }
+    s64 mask_time = getBenchmarkNanoSeconds() - begin;
+
+    begin = getBenchmarkNanoSeconds();
+    for (s32 i = 0; i < row_num; i++) {
+        const HitSensor* sensor = group->getSensor(i);
+        for (s32 j = 0; j < sensor_count; j++) {
+            if (j % 64 == 0)
+                scalar_masks[i * word_num + j / 64] = 0;
+            const HitSensor* other_sensor = group2->getSensor(j);
+            sead::Vector3f distance = sensor->getPos() - other_sensor->getPos();
+            f32 combined_radius = sensor->getRadius() + other_sensor->getRadius();
+            if (!(distance.squaredLength() >= sead::Mathf::square(combined_radius)))
+                scalar_masks[i * word_num + j / 64] |= 1ull << (j % 64);
+        }
+    }
+    s64 scalar_time = getBenchmarkNanoSeconds() - begin;
+
+    s32 mismatch_num = 0;
+    s32 overlap_num = 0;
+    for (s32 i = 0; i < row_num * word_num; i++) {
+        if (masks[i] != scalar_masks[i])
+            mismatch_num++;
+        overlap_num += __builtin_popcountll(scalar_masks[i]);
+    }
+    delete[] masks;
+    delete[] scalar_masks;
+    delete set;
+
+    report->beginResult();
+    report->addString("name", "overlapMask");
+    report->addString("layout", layoutName);
+    report->addInt("sensorNum", layout.sensorNum);
+    report->addInt("overlapNum", overlap_num);
+    report->addFloat("maskUs", mask_time / 1000.0);
+    report->addFloat("scalarUs", scalar_time / 1000.0);
+    report->endResult();
+    return mismatch_num == 0;
+}
+}  // namespace
+
+// Host stand-ins for the HitSensor constructor, SensorHitGroup::remove and the async executors
+// the job queue runs its workers on, none of which are decompiled yet. HitSensor::update is not
+// either, so sensors stay at their offset. The workers are plain threads.
+HitSensor::HitSensor(LiveActor* parentActor, const char* name, u32 hitSensorType, f32 radius,
+                     u16 maxSensorCount, const sead::Vector3f* followPos,
+                     const sead::Matrix34f* followMatrix, const sead::Vector3f& offset)
+    : mName(name), mSensorType(static_cast<HitSensorType>(hitSensorType)), mRadius(radius),
+      mMaxSensorCount(maxSensorCount), mParentActor(parentActor), mFollowPos(followPos),
+      mFollowMtx(followMatrix), mFollowPosOffset(offset) {
+    if (mMaxSensorCount != 0)
+        mSensors = new HitSensor*[mMaxSensorCount];
+    mPos = followPos ? *followPos + offset : offset;
+}
+
+void SensorHitGroup::remove(HitSensor* sensor) {
+    for (s32 i = 0; i < mSensorCount; i++) {
+        if (mSensors[i] != sensor)
+            continue;
+        for (s32 j = i + 1; j < mSensorCount; j++)
+            mSensors[j - 1] = mSensors[j];
+        mSensorCount--;
+        return;
+    }
+}
+
+ExecuteAsyncExecutor::ExecuteAsyncExecutor(const ExecuteDirector* director, const char* name,
+                                           sead::CoreId coreId)
+    : mName(name) {}
+
+ExecuteAsyncExecutor::~ExecuteAsyncExecutor() = default;
+
+void ExecuteAsyncExecutor::executeAsync() {
+    sAsyncThreads[this] = std::thread([this] { execute(); });
+}
+
+void ExecuteAsyncExecutor::waitAsync() {
+    sAsyncThreads[this].join();
+}
+
+// Scaling of the group grid and of the job queue from small groups up to the grid capacity, for
+// evenly spread, clustered and far away sensors.
+void runSensorBenchmark(BenchmarkReport* report, bool isQuick) {
+    report->beginSuite("sensor");
+    SensorLayout* layout = new SensorLayout;
+    SensorHitCheckJobQueue* job_queue = new SensorHitCheckJobQueue(nullptr);
+    s32 repeat_num = isQuick ? 2 : 20;
+
+    bool is_same_pairs = true;
+    bool is_same_hits = true;
+    bool is_same_masks = true;
+    for (s32 l = 0; l < cLayoutNum; l++) {
+        for (s32 sensor_num : cSensorNums) {
+            createLayout(layout, l, sensor_num, sensor_num + l);
+            is_same_pairs = measureGrid(report, *layout, cLayoutNames[l], repeat_num) &&
+                            is_same_pairs;
+            is_same_hits = measureJobQueue(report, job_queue, *layout, cLayoutNames[l],
+                                           repeat_num) &&
+                           is_same_hits;
+            is_same_masks = measureOverlapMask(report, *layout, cLayoutNames[l]) && is_same_masks;
+        }
+    }
+    report->check("gridSamePairs", is_same_pairs);
+    report->check("jobQueueSameHitSensors", is_same_hits);
+    report->check("overlapMaskSameAsScalar", is_same_masks);
+
+    delete layout;
+    report->endSuite();
+}
+
+}  // namespace al
@@ -0,0 +1,73 @@
+#include <cstdio>
+#include <cstring>
+#include <heap/seadExpHeap.h>
+#include <heap/seadHeapMgr.h>
+#include <string>
+
+#include "BenchmarkReport.h"
+#include "Benchmarks.h"
+
+namespace {
+constexpr size_t cHeapSize = 512 * 1024 * 1024;
+
+void printUsage() {
+    fprintf(stderr, "usage: al_benchmark [--quick] [--json path] [--suite byaml|kcollision|sensor]\n"
+                    "The suite option may be given several times, all suites run without it.\n");
+}
+
+bool isSelected(const char* const* suites, int suiteNum, const char* name) {
+    if (suiteNum == 0)
+        return true;
+    for (int i = 0; i < suiteNum; i++)
+        if (strcmp(suites[i], name) == 0)
+            return true;
+    return false;
+}
+}  // namespace
+
+// Runs the library benchmarks on the host and writes the report as JSON, to stdout without
+// --json. Exits with 1 if any check failed.
+int main(int argc, char** argv) {
+    bool is_quick = false;
+    const char* json_path = nullptr;
+    const char* suites[8];
+    int suite_num = 0;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--quick") == 0) {
+            is_quick = true;
+        } else if (strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            json_path = argv[++i];
+        } else if (strcmp(argv[i], "--suite") == 0 && i + 1 < argc && suite_num < 8) {
+            suites[suite_num++] = argv[++i];
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+
+    sead::HeapMgr::initialize(cHeapSize);
+    sead::Heap* heap = sead::ExpHeap::create(0, "Benchmark", sead::HeapMgr::getRootHeap(0), 8,
+                                             sead::Heap::cHeapDirection_Forward, false);
+    sead::ScopedCurrentHeapSetter setter(heap);
+
+    al::BenchmarkReport report;
+    if (isSelected(suites, suite_num, "byaml"))
+        al::runByamlBenchmark(&report, heap, is_quick);
+    if (isSelected(suites, suite_num, "kcollision"))
+        al::runKCollisionBenchmark(&report, is_quick);
+    if (isSelected(suites, suite_num, "sensor"))
+        al::runSensorBenchmark(&report, is_quick);
+
+    std::string json = report.createJson();
+    FILE* file = json_path ? fopen(json_path, "w") : stdout;
+    if (!file) {
+        fprintf(stderr, "could not open %s\n", json_path);
+        return 1;
+    }
+    fputs(json.c_str(), file);
+    if (file != stdout)
+        fclose(file);
+
+    fprintf(stderr, "%d checks, %d failed\n", report.getCheckNum(), report.getFailedCheckNum());
+    return report.getFailedCheckNum() == 0 ? 0 : 1;
+}
@@ -0,0 +1,619 @@
+#!/usr/bin/env python3
+
+# Builds, checks and measures KCL collision files on the host, for tuning the octree that
+# al::KCollisionServer searches (lib/al/Library/Collision/KCollisionServer.h).
+#
+#   cook      builds a single-model KCL from an OBJ file or a triangle soup
+#   validate  checks the headers, the prisms and the octree of a KCL file
+#   stats     reports the octree depth and leaf occupancy of a KCL file
+#
+# Layout (little endian, offsets of a model are relative to its KCPrismHeader):
+#
+#   file header   u32 version, u32 octree offset, u32 model offset table offset, u32 model num,
+#                 f32[3] min, f32[3] max, u32[3] width shift, u32 attribute offset
+#   KCPrismHeader u32 positions/normals/prisms/octree offset, f32 thickness, f32[3] octree
+#                 origin, u32[3] width mask, u32[3] width shift, f32 hitbox radius cap
+#   KCPrismData   f32 length, u16 position, u16 face normal, u16[3] edge normals,
+#                 u16 collision type, u32 triangle index
+#
+# The model octree starts with one u32 per root block, indexed by
+# ((z >> shift.x) << shift.z) | ((y >> shift.x) << shift.y) | (x >> shift.x) in area offset space.
+# A node with the top bit set is a leaf and the other bits are the offset of its prism list, a
+# list of u16 prism indices ended by 0xFFFF. Any other node is the offset of its 8 children,
+# indexed by x | y << 1 | z << 2 of the next lower coordinate bit. Both offsets are relative to
+# the first node of the array holding the node.
+#
+# Prisms follow the convention of KCollisionServer: the edge normals point out of the triangle,
+# and a point lies over the face when its distance along both the first and second edge normal
+# is at most 0 and its distance along the third one is at most the prism length.
+
+import argparse
+import json
+import math
+import struct
+import sys
+
+KCL_VERSION = 0x02020000
+FILE_HEADER_FORMAT = "<4I3f3f3I I"
+MODEL_HEADER_FORMAT = "<4If3f3I3If"
+PRISM_FORMAT = "<f6HI"
+LEAF_FLAG = 0x80000000
+LIST_END = 0xFFFF
+
+FILE_HEADER_SIZE = struct.calcsize(FILE_HEADER_FORMAT)
+MODEL_HEADER_SIZE = struct.calcsize(MODEL_HEADER_FORMAT)
+PRISM_SIZE = struct.calcsize(PRISM_FORMAT)
+
+# ------
+# VECTOR
+# ------
+
+def sub(a, b):
+    return (a[0] - b[0], a[1] - b[1], a[2] - b[2])
+
+def add(a, b):
+    return (a[0] + b[0], a[1] + b[1], a[2] + b[2])
+
+def scale(a, s):
+    return (a[0] * s, a[1] * s, a[2] * s)
+
+def dot(a, b):
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2]
+
+def cross(a, b):
+    return (a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0])
+
+def length(a):
+    return math.sqrt(dot(a, a))
+
+def normalize(a):
+    l = length(a)
+    return scale(a, 1.0 / l) if l > 0.0 else a
+
+def is_nan_vector(a):
+    return any(math.isnan(x) for x in a)
+
+def round_f32(a):
+    return struct.unpack("<3f", struct.pack("<3f", *a))
+
+# ----
+# COOK
+# ----
+
+def read_obj(path):
+    vertices = []
+    triangles = []
+    materials = {}
+    material = 0
+    with open(path) as f:
+        for line in f:
+            words = line.split()
+            if not words:
+                continue
+            if words[0] == "v":
+                vertices.append(tuple(float(x) for x in words[1:4]))
+            elif words[0] == "usemtl":
+                material = materials.setdefault(" ".join(words[1:]), len(materials))
+            elif words[0] == "f":
+                face = []
+                for word in words[1:]:
+                    index = int(word.split("/")[0])
+                    face.append(vertices[index - 1 if index > 0 else index])
+                # polygons are split into a fan
+                for i in range(1, len(face) - 1):
+                    triangles.append((face[0], face[i], face[i + 1], material))
+    return triangles
+
+def read_soup(path):
+    triangles = []
+    with open(path) as f:
+        for line in f:
+            values = line.split()
+            if not values or values[0].startswith("#"):
+                continue
+            values = [float(x) for x in values]
+            material = int(values[9]) if len(values) > 9 else 0
+            triangles.append((tuple(values[0:3]), tuple(values[3:6]), tuple(values[6:9]),
+                              material))
+    return triangles
+
+def make_prism(a, b, c):
+    face = normalize(cross(sub(b, a), sub(c, a)))
+    edge1 = normalize(cross(face, sub(c, a)))
+    edge2 = normalize(cross(sub(b, a), face))
+    edge3 = normalize(cross(sub(c, b), face))
+    return face, edge1, edge2, edge3, dot(sub(b, a), edge3)
+
+def is_degenerate(a, b, c):
+    area = length(cross(sub(b, a), sub(c, a)))
+    longest = max(length(sub(b, a)), length(sub(c, a)), length(sub(c, b)))
+    return area <= 1e-6 * max(longest * longest, 1e-12)
+
+# Separating axis test of a triangle against the cube [lo, lo + size], after Akenine-Moller.
+def overlaps_box(tri, lo, size, margin):
+    half = size * 0.5 + margin
+    center = (lo[0] + size * 0.5, lo[1] + size * 0.5, lo[2] + size * 0.5)
+    v = [sub(p, center) for p in tri]
+    for axis in range(3):
+        values = [p[axis] for p in v]
+        if min(values) > half or max(values) < -half:
+            return False
+
+    edges = [sub(v[1], v[0]), sub(v[2], v[1]), sub(v[0], v[2])]
+    normal = cross(edges[0], edges[1])
+    radius = half * (abs(normal[0]) + abs(normal[1]) + abs(normal[2]))
+    if abs(dot(normal, v[0])) > radius:
+        return False
+
+    for edge in edges:
+        for axis in ((0.0, -edge[2], edge[1]), (edge[2], 0.0, -edge[0]),
+                     (-edge[1], edge[0], 0.0)):
+            values = [dot(p, axis) for p in v]
+            radius = half * (abs(axis[0]) + abs(axis[1]) + abs(axis[2]))
+            if min(values) > radius or max(values) < -radius:
+                return False
+    return True
+
+class Leaf:
+    def __init__(self, prisms):
+        self.prisms = prisms
+
+class Branch:
+    def __init__(self, children):
+        self.children = children
+
+def build_node(tris, prisms, lo, shift, args):
+    if len(prisms) <= args.max_prisms or shift <= args.min_leaf_shift:
+        return Leaf(prisms)
+
+    child_size = 1 << (shift - 1)
+    children = []
+    for i in range(8):
+        child_lo = (lo[0] + (i & 1) * child_size, lo[1] + (i >> 1 & 1) * child_size,
+                    lo[2] + (i >> 2 & 1) * child_size)
+        inside = [p for p in prisms if overlaps_box(tris[p], child_lo, child_size, args.margin)]
+        children.append(build_node(tris, inside, child_lo, shift - 1, args))
+    return Branch(children)
+
+def log2_ceil(x):
+    return max(0, math.ceil(math.log2(x))) if x > 1 else 0
+
+def build_model(triangles, args):
+    positions = {}
+    normals = {}
+    prisms = []
+    tris = []
+    skipped = 0
+
+    def index_of(table, value):
+        return table.setdefault(round_f32(value), len(table))
+
+    for a, b, c, material in triangles:
+        if is_degenerate(a, b, c):
+            skipped += 1
+            continue
+        face, edge1, edge2, edge3, prism_length = make_prism(a, b, c)
+        prisms.append((prism_length, index_of(positions, a), index_of(normals, face),
+                       index_of(normals, edge1), index_of(normals, edge2),
+                       index_of(normals, edge3), material, len(prisms)))
+        tris.append((a, b, c))
+
+    if not prisms:
+        sys.exit("error: no usable triangles")
+    if len(positions) > LIST_END or len(normals) > LIST_END or len(prisms) > LIST_END:
+        sys.exit("error: too many positions, normals or prisms for 16-bit indices")
+
+    lo = [min(p[axis] for t in tris for p in t) - args.margin for axis in range(3)]
+    hi = [max(p[axis] for t in tris for p in t) + args.margin for axis in range(3)]
+    extent = max(hi[axis] - lo[axis] for axis in range(3))
+    root_shift = args.root_shift
+    if root_shift is None:
+        root_shift = max(args.min_leaf_shift, log2_ceil(extent) - 3)
+    root_size = 1 << root_shift
+
+    # every axis holds a power of two of root blocks, so the block index is a bit shift
+    block_num = [1 << log2_ceil(math.ceil((hi[axis] - lo[axis]) / root_size))
+                 for axis in range(3)]
+    width_shift = (root_shift, log2_ceil(block_num[0]),
+                   log2_ceil(block_num[0]) + log2_ceil(block_num[1]))
+    width_mask = tuple(~(block_num[axis] * root_size - 1) & 0xFFFFFFFF for axis in range(3))
+    origin = tuple(lo)
+    area_tris = [tuple(sub(p, origin) for p in t) for t in tris]
+
+    buckets = {}
+    for i, t in enumerate(area_tris):
+        first = [max(0, int(min(p[axis] for p in t) - args.margin) >> root_shift)
+                 for axis in range(3)]
+        last = [min(block_num[axis] - 1, int(max(p[axis] for p in t) + args.margin) >> root_shift)
+                for axis in range(3)]
+        for z in range(first[2], last[2] + 1):
+            for y in range(first[1], last[1] + 1):
+                for x in range(first[0], last[0] + 1):
+                    buckets.setdefault((x, y, z), []).append(i)
+
+    roots = []
+    for z in range(block_num[2]):
+        for y in range(block_num[1]):
+            for x in range(block_num[0]):
+                block_lo = (x * root_size, y * root_size, z * root_size)
+                inside = [p for p in buckets.get((x, y, z), [])
+                          if overlaps_box(area_tris[p], block_lo, root_size, args.margin)]
+                roots.append(build_node(area_tris, inside, block_lo, root_shift, args))
+
+    return {
+        "positions": sorted(positions, key=positions.get),
+        "normals": sorted(normals, key=normals.get),
+        "prisms": prisms,
+        "roots": roots,
+        "origin": origin,
+        "width_mask": width_mask,
+        "width_shift": width_shift,
+        "min": tuple(lo),
+        "max": tuple(hi),
+        "skipped": skipped,
+    }
+
+def write_octree(roots):
+    # node arrays are laid out breadth first, followed by the deduplicated prism lists
+    arrays = [roots]
+    array_offsets = [0]
+    offset = len(roots) * 4
+    i = 0
+    while i < len(arrays):
+        for node in arrays[i]:
+            if isinstance(node, Branch):
+                arrays.append(node.children)
+                array_offsets.append(offset)
+                offset += 32
+        i += 1
+
+    lists = {}
+    list_data = bytearray()
+    for nodes in arrays:
+        for node in nodes:
+            if isinstance(node, Leaf):
+                key = tuple(node.prisms)
+                if key not in lists:
+                    lists[key] = offset + len(list_data)
+                    list_data += struct.pack("<%dH" % (len(key) + 1), *key, LIST_END)
+
+    data = bytearray()
+    child_index = 1
+    for nodes, base in zip(arrays, array_offsets):
+        for node in nodes:
+            if isinstance(node, Branch):
+                data += struct.pack("<I", array_offsets[child_index] - base)
+                child_index += 1
+            else:
+                data += struct.pack("<I", LEAF_FLAG | (lists[tuple(node.prisms)] - base))
+    return bytes(data + list_data)
+
+def align(data, alignment=4):
+    while len(data) % alignment:
+        data.append(0)
+
+def cook(args):
+    triangles = read_obj(args.input) if args.input.lower().endswith(".obj") else \
+        read_soup(args.input)
+    model = build_model(triangles, args)
+
+    body = bytearray()
+    positions_offset = MODEL_HEADER_SIZE
+    for p in model["positions"]:
+        body += struct.pack("<3f", *p)
+    normals_offset = MODEL_HEADER_SIZE + len(body)
+    for n in model["normals"]:
+        body += struct.pack("<3f", *n)
+    prisms_offset = MODEL_HEADER_SIZE + len(body)
+    for p in model["prisms"]:
+        body += struct.pack(PRISM_FORMAT, *p)
+    align(body)
+    octree_offset = MODEL_HEADER_SIZE + len(body)
+    body += write_octree(model["roots"])
+    align(body)
+
+    model_header = struct.pack(MODEL_HEADER_FORMAT, positions_offset, normals_offset,
+                               prisms_offset, octree_offset, args.thickness, *model["origin"],
+                               *model["width_mask"], *model["width_shift"], args.radius_cap)
+
+    # a single model covers the whole file, so the file octree is one leaf holding model 0
+    model_table_offset = FILE_HEADER_SIZE
+    file_octree_offset = model_table_offset + 4
+    model_offset = file_octree_offset + 4
+    extent = max(model["max"][axis] - model["min"][axis] for axis in range(3))
+    file_shift = log2_ceil(extent)
+    header = struct.pack(FILE_HEADER_FORMAT, KCL_VERSION, file_octree_offset, model_table_offset,
+                         1, *model["min"], *model["max"], file_shift, 0, 0, 0)
+    data = header + struct.pack("<I", model_offset) + struct.pack("<I", LEAF_FLAG) + \
+        model_header + body
+
+    with open(args.output, "wb") as f:
+        f.write(data)
+    print("%s: %d prisms, %d positions, %d normals, %d skipped, %d bytes" %
+          (args.output, len(model["prisms"]), len(model["positions"]), len(model["normals"]),
+           model["skipped"], len(data)))
+
+# ----
+# READ
+# ----
+
+class KclError(Exception):
+    pass
+
+class Model:
+    def __init__(self, data, offset):
+        if offset + MODEL_HEADER_SIZE > len(data):
+            raise KclError("model header at 0x%x is out of bounds" % offset)
+        values = struct.unpack_from(MODEL_HEADER_FORMAT, data, offset)
+        self.data = data
+        self.offset = offset
+        self.positions_offset, self.normals_offset, self.prisms_offset, self.octree_offset = \
+            values[0:4]
+        self.thickness = values[4]
+        self.origin = values[5:8]
+        self.width_mask = values[8:11]
+        self.width_shift = values[11:14]
+        self.radius_cap = values[14]
+
+        offsets = [self.positions_offset, self.normals_offset, self.prisms_offset,
+                   self.octree_offset]
+        if offsets != sorted(offsets) or offset + self.octree_offset > len(data):
+            raise KclError("model at 0x%x has unordered or out of bounds offsets" % offset)
+
+        self.position_num = (self.normals_offset - self.positions_offset) // 12
+        self.normal_num = (self.prisms_offset - self.normals_offset) // 12
+        self.prism_num = (self.octree_offset - self.prisms_offset) // PRISM_SIZE
+        self.positions = [struct.unpack_from("<3f", data, offset + self.positions_offset + i * 12)
+                          for i in range(self.position_num)]
+        self.normals = [struct.unpack_from("<3f", data, offset + self.normals_offset + i * 12)
+                        for i in range(self.normal_num)]
+        self.prisms = [struct.unpack_from(PRISM_FORMAT, data,
+                                          offset + self.prisms_offset + i * PRISM_SIZE)
+                       for i in range(self.prism_num)]
+        self.area_size = tuple((~mask & 0xFFFFFFFF) + 1 for mask in self.width_mask)
+        self.root_size = 1 << self.width_shift[0]
+        self.block_num = tuple(size >> self.width_shift[0] for size in self.area_size)
+
+    def octree_address(self):
+        return self.offset + self.octree_offset
+
+    def read_u32(self, address):
+        if address < 0 or address + 4 > len(self.data):
+            raise KclError("octree node at 0x%x is out of bounds" % address)
+        return struct.unpack_from("<I", self.data, address)[0]
+
+    def read_list(self, address):
+        prisms = []
+        while True:
+            if address < 0 or address + 2 > len(self.data):
+                raise KclError("prism list at 0x%x runs out of bounds" % address)
+            index = struct.unpack_from("<H", self.data, address)[0]
+            if index == LIST_END:
+                return prisms
+            prisms.append(index)
+            address += 2
+
+    def root_address(self, x, y, z):
+        shift = self.width_shift
+        index = (z >> shift[0] << shift[2]) | (y >> shift[0] << shift[1]) | (x >> shift[0])
+        return self.octree_address() + index * 4
+
+    # Calls visit(lo, shift, depth, list address) for every leaf, in octree order.
+    def walk_leaves(self, visit):
+        def walk(base, address, lo, shift, depth):
+            size = 1 << shift
+            node = self.read_u32(address)
+            if node & LEAF_FLAG:
+                visit(lo, shift, depth, base + (node & ~LEAF_FLAG))
+                return
+            if shift == 0:
+                raise KclError("octree at 0x%x is deeper than the block size" % address)
+            child_base = base + node
+            half = size >> 1
+            for i in range(8):
+                child_lo = (lo[0] + (i & 1) * half, lo[1] + (i >> 1 & 1) * half,
+                            lo[2] + (i >> 2 & 1) * half)
+                walk(child_base, child_base + i * 4, child_lo, shift - 1, depth + 1)
+
+        root_size = self.root_size
+        for z in range(self.block_num[2]):
+            for y in range(self.block_num[1]):
+                for x in range(self.block_num[0]):
+                    lo = (x * root_size, y * root_size, z * root_size)
+                    walk(self.octree_address(), self.root_address(*lo), lo, self.width_shift[0],
+                         0)
+
+def read_kcl(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < FILE_HEADER_SIZE:
+        raise KclError("file is smaller than the header")
+    header = struct.unpack_from(FILE_HEADER_FORMAT, data, 0)
+    if header[0] != KCL_VERSION:
+        raise KclError("unknown version 0x%08x" % header[0])
+    model_table_offset, model_num = header[2], header[3]
+    if model_table_offset + model_num * 4 > len(data):
+        raise KclError("model offset table is out of bounds")
+    models = []
+    for i in range(model_num):
+        offset = struct.unpack_from("<I", data, model_table_offset + i * 4)[0]
+        models.append(Model(data, offset))
+    return models
+
+# --------
+# VALIDATE
+# --------
+
+def validate_model(model, index, args):
+    problems = []
+
+    def report(message):
+        problems.append("model %d: %s" % (index, message))
+
+    for axis in range(3):
+        size = model.area_size[axis]
+        if size & (size - 1) or size < model.root_size:
+            report("width mask 0x%08x is not a power of two above the block size" %
+                   model.width_mask[axis])
+    if model.block_num[0] != 1 << (model.width_shift[1]) or \
+            model.block_num[0] * model.block_num[1] != 1 << model.width_shift[2]:
+        report("width shift %s does not match the root block counts %s" %
+               (model.width_shift, model.block_num))
+
+    for i, prism in enumerate(model.prisms):
+        prism_length, position, face, edge1, edge2, edge3 = prism[0:6]
+        if position >= model.position_num:
+            report("prism %d: position index %d out of range" % (i, position))
+            continue
+        if max(face, edge1, edge2, edge3) >= model.normal_num:
+            report("prism %d: normal index out of range" % i)
+            continue
+        face_normal = model.normals[face]
+        edge_normals = [model.normals[edge1], model.normals[edge2], model.normals[edge3]]
+        # same checks as isNanPrism and isNearParallelNormal
+        if math.isnan(prism_length) or is_nan_vector(model.positions[position]) or \
+                any(is_nan_vector(n) for n in [face_normal] + edge_normals):
+            report("prism %d: NaN in prism data" % i)
+            continue
+        if any(abs(dot(face_normal, n)) > args.parallel_limit for n in edge_normals):
+            report("prism %d: edge normal near parallel to face normal" % i)
+        if any(abs(length(n) - 1.0) > 1e-3 for n in [face_normal] + edge_normals):
+            report("prism %d: normal is not unit length" % i)
+        if not prism_length > 0.0:
+            report("prism %d: length %f is not positive" % (i, prism_length))
+
+    referenced = set()
+
+    def visit(lo, shift, depth, address):
+        for prism in model.read_list(address):
+            if prism >= model.prism_num:
+                report("leaf at %s: prism index %d out of range" % (lo, prism))
+            else:
+                referenced.add(prism)
+
+    try:
+        model.walk_leaves(visit)
+    except KclError as e:
+        report(str(e))
+    unreferenced = model.prism_num - len(referenced)
+    if unreferenced:
+        report("%d prisms are in no octree leaf" % unreferenced)
+    return problems
+
+def validate(args):
+    failed = False
+    for path in args.input:
+        try:
+            models = read_kcl(path)
+            problems = []
+            for i, model in enumerate(models):
+                problems += validate_model(model, i, args)
+        except KclError as e:
+            problems = [str(e)]
+        for problem in problems[:args.max_problems]:
+            print("%s: %s" % (path, problem))
+        if len(problems) > args.max_problems:
+            print("%s: ... %d more" % (path, len(problems) - args.max_problems))
+        if problems:
+            failed = True
+        else:
+            print("%s: OK" % path)
+    sys.exit(1 if failed else 0)
+
+# -----
+# STATS
+# -----
+
+def percentile(values, fraction):
+    if not values:
+        return 0
+    return sorted(values)[min(len(values) - 1, int(len(values) * fraction))]
+
+def model_stats(model):
+    depths = {}
+    sizes = {}
+    occupancy = []
+    lists = set()
+
+    def visit(lo, shift, depth, address):
+        depths[depth] = depths.get(depth, 0) + 1
+        sizes[1 << shift] = sizes.get(1 << shift, 0) + 1
+        occupancy.append(len(model.read_list(address)))
+        lists.add(address)
+
+    model.walk_leaves(visit)
+    return {
+        "prisms": model.prism_num,
+        "positions": model.position_num,
+        "normals": model.normal_num,
+        "area_size": model.area_size,
+        "root_blocks": model.block_num,
+        "width_shift": model.width_shift,
+        "leaves": len(occupancy),
+        "unique_lists": len(lists),
+        "empty_leaves": sum(1 for n in occupancy if n == 0),
+        "leaves_by_depth": dict(sorted(depths.items())),
+        "leaves_by_size": dict(sorted(sizes.items())),
+        "prisms_per_leaf": {
+            "mean": sum(occupancy) / max(1, len(occupancy)),
+            "median": percentile(occupancy, 0.5),
+            "p90": percentile(occupancy, 0.9),
+            "max": max(occupancy, default=0),
+        },
+        "list_entries": sum(occupancy),
+        "octree_bytes": len(model.data) - model.octree_address(),
+    }
+
+def stats(args):
+    result = {}
+    for path in args.input:
+        result[path] = [model_stats(model) for model in read_kcl(path)]
+    if args.json:
+        print(json.dumps(result, indent=2))
+        return
+    for path, models in result.items():
+        for i, s in enumerate(models):
+            print("%s model %d" % (path, i))
+            for key, value in s.items():
+                print("  %-16s %s" % (key, value))
+
+def main():
+    parser = argparse.ArgumentParser(description="Build, check and measure KCL collision files")
+    commands = parser.add_subparsers(dest="command", required=True)
+
+    cook_parser = commands.add_parser("cook", help="Build a KCL from an OBJ or triangle soup")
+    cook_parser.add_argument("input", help="OBJ file, or text file with 9 coordinates per line")
+    cook_parser.add_argument("output", help="KCL file to write")
+    cook_parser.add_argument("--max-prisms", type=int, default=16,
+                             help="Split octree leaves holding more prisms than this")
+    cook_parser.add_argument("--min-leaf-shift", type=int, default=3,
+                             help="Never split leaves of 2^shift units or less")
+    cook_parser.add_argument("--root-shift", type=int, default=None,
+                             help="Size of the root blocks as 2^shift units")
+    cook_parser.add_argument("--margin", type=float, default=0.01,
+                             help="Grow octree cells by this much when sorting prisms in")
+    cook_parser.add_argument("--thickness", type=float, default=30.0, help="Prism thickness")
+    cook_parser.add_argument("--radius-cap", type=float, default=0.0, help="Hitbox radius cap")
+    cook_parser.set_defaults(func=cook)
+
+    validate_parser = commands.add_parser("validate", help="Check KCL files for broken data")
+    validate_parser.add_argument("input", nargs="+", help="KCL files to check")
+    validate_parser.add_argument("--parallel-limit", type=float, default=0.999,
+                                 help="Largest allowed |dot| of face and edge normals")
+    validate_parser.add_argument("--max-problems", type=int, default=20,
+                                 help="Problems to print per file")
+    validate_parser.set_defaults(func=validate)
+
+    stats_parser = commands.add_parser("stats", help="Report octree depth and occupancy")
+    stats_parser.add_argument("input", nargs="+", help="KCL files to inspect")
+    stats_parser.add_argument("--json", action="store_true", help="Print JSON")
+    stats_parser.set_defaults(func=stats)
+
+    args = parser.parse_args()
+    try:
+        args.func(args)
+    except KclError as e:
+        sys.exit("error: %s" % e)
+
+if __name__ == "__main__":
+    main()